@@ -1,8 +1,13 @@
 <?php
 /*
- * Copies AVR8 target description files to AVR_TDF_DEST_FILE_PATH, in preparation for a build, and creates a JSON
- * mapping of target signatures to file paths (relative to Bloom's resource directory).
- * The JSON mapping is compiled as a Qt resource and used for looking-up target description file paths, by target ID.
+ * Copies AVR8 target description files to AVR_TDF_DEST_FILE_PATH, in preparation for a build, and generates a C++
+ * header containing a mapping of target IDs to file paths (relative to Bloom's resource directory), signatures and
+ * families. The mapping is compiled into Bloom and used for looking-up target description files, by target ID.
+ * See Targets::Microchip::Avr::Avr8Bit::TargetDescription::TargetDescriptionFileMapping for more.
+ *
+ * If the second argument is "1" (see the COMPILE_TARGET_DESCRIPTION_FILES CMake option), each TDF is also compiled to
+ * Bloom's binary TDF format (see TargetDescriptionFiles/CompiledTdfWriter.php), which Bloom will load in place of the
+ * XML, where possible. Otherwise, the mapping will not reference any compiled TDFs, and Bloom will parse the XML.
  *
  * This script should be run as part of the build process.
  */
@@ -15,11 +20,14 @@ if (empty($buildPath)) {
     exit(1);
 }
 
+$compileTdfs = ($argv[2] ?? "0") === "1";
+
 require_once __DIR__ . "/TargetDescriptionFiles/Factory.php";
+require_once __DIR__ . "/TargetDescriptionFiles/CompiledTdfWriter.php";
 
 define("AVR_TDF_DEST_FILE_PATH", $buildPath . "/resources/TargetDescriptionFiles/AVR");
 define("AVR_TDF_DEST_RELATIVE_FILE_PATH", "TargetDescriptionFiles/AVR");
-define("AVR_TDF_MAPPING_FILE_PATH", AVR_TDF_DEST_FILE_PATH . "/Mapping.json");
+define("AVR_TDF_MAPPING_HEADER_FILE_PATH", $buildPath . "/generated/Avr8TargetDescriptionFileMapping.generated.hpp");
 
 // Empty destination directory
 if (file_exists(AVR_TDF_DEST_FILE_PATH)) {
@@ -27,12 +35,16 @@ if (file_exists(AVR_TDF_DEST_FILE_PATH)) {
     exec("rm -r " . AVR_TDF_DEST_FILE_PATH);
 }
 
-if (file_exists(AVR_TDF_MAPPING_FILE_PATH)) {
-    unlink(AVR_TDF_MAPPING_FILE_PATH);
+if (file_exists(AVR_TDF_MAPPING_HEADER_FILE_PATH)) {
+    unlink(AVR_TDF_MAPPING_HEADER_FILE_PATH);
 }
 
 mkdir(AVR_TDF_DEST_FILE_PATH, 0700, true);
 
+if (!file_exists(dirname(AVR_TDF_MAPPING_HEADER_FILE_PATH))) {
+    mkdir(dirname(AVR_TDF_MAPPING_HEADER_FILE_PATH), 0700, true);
+}
+
 print "Loading AVR8 TDFs\n\n";
 
 $tdfMapping = [];
@@ -46,7 +58,7 @@ foreach ($avrTdfs as $avrTdf) {
     $strippedTargetName = str_replace([' '] , '_', $avrTdf->targetName);
     $id = strtolower($strippedTargetName);
 
-    if (in_array($id, $tdfMapping)) {
+    if (isset($tdfMapping[$id])) {
         print "\033[31m" . "\n";
         print "FATAL ERROR: duplicate AVR8 target ID detected: " . $id . "\n\n"
             . "TDF Path: " . realpath($avrTdf->filePath);
@@ -93,19 +105,62 @@ foreach ($avrTdfs as $avrTdf) {
         exit(1);
     }
 
+    $signature = $avrTdf->getSignature();
     $tdfMapping[$id] = [
         'name' => $strippedTargetName,
-        'signature' => $avrTdf->getSignature()->toHex(),
+        'signature' => [$signature->byteZero, $signature->byteOne, $signature->byteTwo],
+        'family' => $avrFamily,
         'tdfPath' => $relativeDestinationFilePath,
+        'compiledTdfPath' => '',
     ];
+
+    if (!$compileTdfs) {
+        continue;
+    }
+
+    // A TDF that fails to compile is not fatal - Bloom will just fall back to parsing the XML
+    $compiledFilePath = substr($destinationFilePath, 0, -strlen(".xml")) . ".btdf";
+    if (TargetDescriptionFiles\CompiledTdfWriter::write($avrTdf->filePath, $compiledFilePath)) {
+        $tdfMapping[$id]['compiledTdfPath'] = substr($relativeDestinationFilePath, 0, -strlen(".xml")) . ".btdf";
+    }
 }
 
-if (file_put_contents(AVR_TDF_MAPPING_FILE_PATH, json_encode($tdfMapping, JSON_PRETTY_PRINT)) === false) {
-    print "FATAL ERROR: Failed to create JSON mapping of target IDs to target description file paths\n";
+// The mapping must be sorted by target ID, as we perform binary searches on it
+ksort($tdfMapping, SORT_STRING);
+
+$escape = fn (string $value): string => '"' . addcslashes($value, "\"\\") . '"';
+
+$mappingHeader = "// Generated by build/scripts/Avr8TargetDescriptionFiles.php - do not edit.\n\n"
+    . "#pragma once\n\n"
+    . "#include <array>\n\n"
+    . "#include \"src/Targets/Microchip/AVR/AVR8/TargetDescription/TargetDescriptionFileMapping.hpp\"\n\n"
+    . "namespace Targets::Microchip::Avr::Avr8Bit::TargetDescription\n{\n"
+    . "    inline constexpr auto GENERATED_TARGET_DESCRIPTION_FILE_MAPPING = std::array<\n"
+    . "        TargetDescriptionFileMapping::Entry,\n"
+    . "        " . count($tdfMapping) . "\n"
+    . "    >{\n";
+
+foreach ($tdfMapping as $id => $entry) {
+    $mappingHeader .= "        TargetDescriptionFileMapping::Entry{\n"
+        . "            .id = " . $escape((string) $id) . ",\n"
+        . "            .name = " . $escape($entry['name']) . ",\n"
+        . "            .signatureByteZero = " . sprintf("0x%02X", $entry['signature'][0]) . ",\n"
+        . "            .signatureByteOne = " . sprintf("0x%02X", $entry['signature'][1]) . ",\n"
+        . "            .signatureByteTwo = " . sprintf("0x%02X", $entry['signature'][2]) . ",\n"
+        . "            .family = Family::" . $entry['family'] . ",\n"
+        . "            .tdfPath = " . $escape($entry['tdfPath']) . ",\n"
+        . "            .compiledTdfPath = " . $escape($entry['compiledTdfPath']) . ",\n"
+        . "        },\n";
+}
+
+$mappingHeader .= "    };\n}\n";
+
+if (file_put_contents(AVR_TDF_MAPPING_HEADER_FILE_PATH, $mappingHeader) === false) {
+    print "FATAL ERROR: Failed to generate mapping of target IDs to target description file paths\n";
     exit(1);
 }
 
 print "\n";
-print "Created JSON mapping of target IDs to target description file paths: " . AVR_TDF_MAPPING_FILE_PATH . "\n\n";
+print "Generated mapping of target IDs to target description file paths: " . AVR_TDF_MAPPING_HEADER_FILE_PATH . "\n\n";
 print "Processed " . count($avrTdfs) . " files.\n";
 print "Done\n";
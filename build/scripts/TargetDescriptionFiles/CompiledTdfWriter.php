@@ -0,0 +1,585 @@
+<?php
+namespace Bloom\BuildScripts\TargetDescriptionFiles;
+
+use Exception;
+use SimpleXMLElement;
+
+/**
+ * Compiles target description files into the binary format that is mapped into memory by Bloom, at runtime.
+ *
+ * See the Targets::TargetDescription::CompiledTargetDescriptionFile class for a description of the format. This
+ * class must be kept in sync with that class, and with the XML parsing in the
+ * Targets::TargetDescription::TargetDescriptionFile class.
+ *
+ * We deliberately don't use the TargetDescriptionFile class (in this directory) here. The compiled TDF must hold
+ * exactly what Bloom would have extracted from the XML, so we walk the XML in the same way Bloom does, skipping the
+ * same invalid elements and converting values in the same way. Note that Qt's QDomElement::elementsByTagName()
+ * searches all descendants, hence the use of './/' in all of our XPath expressions.
+ */
+class CompiledTdfWriter
+{
+    const MAGIC = 0x46445442;
+    const VERSION = 1;
+    const NULL_STRING = 0xFFFFFFFF;
+
+    // The order of these must match CompiledTargetDescriptionFile::Section
+    const SECTION_STRINGS = 0;
+    const SECTION_ADDRESS_SPACES = 1;
+    const SECTION_MEMORY_SEGMENTS = 2;
+    const SECTION_PROPERTY_GROUPS = 3;
+    const SECTION_PROPERTIES = 4;
+    const SECTION_MODULES = 5;
+    const SECTION_PERIPHERAL_MODULES = 6;
+    const SECTION_MODULE_INSTANCES = 7;
+    const SECTION_REGISTER_GROUPS = 8;
+    const SECTION_REGISTERS = 9;
+    const SECTION_BIT_FIELDS = 10;
+    const SECTION_SIGNALS = 11;
+    const SECTION_VARIANTS = 12;
+    const SECTION_PINOUTS = 13;
+    const SECTION_PINS = 14;
+    const SECTION_INTERFACES = 15;
+
+    const RECORD_WORDS = [0, 9, 8, 4, 6, 6, 6, 6, 10, 10, 3, 8, 7, 4, 3, 4];
+
+    const MEMORY_SEGMENT_TYPES = [
+        'regs',
+        'io',
+        'eeprom',
+        'ram',
+        'flash',
+        'signatures',
+        'fuses',
+        'lockbits',
+        'osccal',
+    ];
+
+    private string $strings = '';
+
+    /** @var int[] */
+    private array $stringOffsets = [];
+
+    /** @var array[] Records (arrays of words) mapped by section */
+    private array $sections = [];
+
+    /**
+     * Compiles the TDF at $xmlFilePath and writes the result to $destinationFilePath.
+     *
+     * @param string $xmlFilePath
+     * @param string $destinationFilePath
+     *
+     * @return bool
+     *  False if the TDF could not be compiled. In this case, Bloom will parse the XML at runtime, which will be
+     *  considerably slower, but not fatal.
+     */
+    public static function write(string $xmlFilePath, string $destinationFilePath): bool
+    {
+        try {
+            $writer = new self();
+            return file_put_contents($destinationFilePath, $writer->compile($xmlFilePath)) !== false;
+
+        } catch (Exception $exception) {
+            print "\033[33m" . "WARNING: Failed to compile TDF " . $xmlFilePath . " - " . $exception->getMessage()
+                . "\033[0m" . "\n";
+            return false;
+        }
+    }
+
+    private function __construct()
+    {
+        $this->sections = array_fill(0, count(self::RECORD_WORDS), []);
+    }
+
+    private function compile(string $xmlFilePath): string
+    {
+        $xml = simplexml_load_file($xmlFilePath);
+        if ($xml === false) {
+            throw new Exception("Failed to parse TDF XML");
+        }
+
+        $device = $this->first($xml, '//device');
+        if ($device === null) {
+            throw new Exception("Device element not found");
+        }
+
+        $targetName = $this->stringReference((string) $device['name']);
+        $familyName = $this->stringReference($this->lower((string) $device['family']));
+
+        $this->compileAddressSpaces($device);
+        $this->compilePropertyGroups($device);
+        $this->compileModules($xml);
+        $this->compilePeripheralModules($device);
+        $this->compileVariants($xml);
+        $this->compilePinouts($xml);
+        $this->compileInterfaces($device);
+
+        $strings = $this->strings . str_repeat("\0", (4 - strlen($this->strings) % 4) % 4);
+
+        $sectionCount = count(self::RECORD_WORDS);
+        $offset = (8 + $sectionCount * 2) * 4;
+        $sectionDescriptors = [];
+        $body = '';
+
+        for ($section = 1; $section < $sectionCount; $section++) {
+            $sectionDescriptors[$section] = [$offset, count($this->sections[$section])];
+
+            foreach ($this->sections[$section] as $record) {
+                $body .= $this->pack($record);
+            }
+
+            $offset += count($this->sections[$section]) * self::RECORD_WORDS[$section] * 4;
+        }
+
+        $sectionDescriptors[self::SECTION_STRINGS] = [$offset, strlen($this->strings)];
+        $body .= $strings;
+        $offset += strlen($strings);
+
+        $header = [self::MAGIC, self::VERSION, $offset, ...$targetName, ...$familyName, $sectionCount];
+        for ($section = 0; $section < $sectionCount; $section++) {
+            array_push($header, ...$sectionDescriptors[$section]);
+        }
+
+        return $this->pack($header) . $body;
+    }
+
+    private function compileAddressSpaces(SimpleXMLElement $device): void
+    {
+        $addressSpacesElement = $this->first($device, './/address-spaces');
+        foreach ($this->all($addressSpacesElement, './/address-space') as $addressSpaceElement) {
+            if (
+                !isset($addressSpaceElement['id'])
+                || !isset($addressSpaceElement['name'])
+                || !isset($addressSpaceElement['size'])
+                || !isset($addressSpaceElement['start'])
+            ) {
+                continue;
+            }
+
+            $startAddress = $this->toInteger((string) $addressSpaceElement['start'], 16, 0, 0xFFFFFFFF);
+            $size = $this->toInteger((string) $addressSpaceElement['size'], 16, 0, 0xFFFFFFFF);
+            if ($startAddress === null || $size === null) {
+                continue;
+            }
+
+            $firstSegmentIndex = count($this->sections[self::SECTION_MEMORY_SEGMENTS]);
+
+            foreach ($this->all($addressSpaceElement, './/memory-segment') as $segmentElement) {
+                if (
+                    !isset($segmentElement['type'])
+                    || !isset($segmentElement['name'])
+                    || !isset($segmentElement['size'])
+                    || !isset($segmentElement['start'])
+                    || !in_array((string) $segmentElement['type'], self::MEMORY_SEGMENT_TYPES, true)
+                ) {
+                    continue;
+                }
+
+                $segmentStartAddress = $this->toInteger((string) $segmentElement['start'], 16, 0, 0xFFFFFFFF);
+                $segmentSize = $this->toInteger((string) $segmentElement['size'], 16, 0, 0xFFFFFFFF);
+                if ($segmentStartAddress === null || $segmentSize === null) {
+                    continue;
+                }
+
+                $pageSize = null;
+                if (isset($segmentElement['pagesize'])) {
+                    $pageSizeValue = (string) $segmentElement['pagesize'];
+                    $pageSize = $this->toInteger(
+                        $pageSizeValue,
+                        str_contains($pageSizeValue, '0x') ? 16 : 10,
+                        0,
+                        0xFFFFFFFF
+                    );
+
+                    if ($pageSize === null) {
+                        continue;
+                    }
+                }
+
+                $this->sections[self::SECTION_MEMORY_SEGMENTS][] = [
+                    ...$this->stringReference($this->lower((string) $segmentElement['name'])),
+                    ...$this->stringReference((string) $segmentElement['type']),
+                    $segmentStartAddress,
+                    $segmentSize,
+                    $pageSize !== null ? 1 : 0,
+                    $pageSize ?? 0,
+                ];
+            }
+
+            $this->sections[self::SECTION_ADDRESS_SPACES][] = [
+                ...$this->stringReference((string) $addressSpaceElement['id']),
+                ...$this->stringReference((string) $addressSpaceElement['name']),
+                $startAddress,
+                $size,
+                isset($addressSpaceElement['endianness'])
+                    ? ((string) $addressSpaceElement['endianness'] === 'little' ? 1 : 0)
+                    : 1,
+                $firstSegmentIndex,
+                count($this->sections[self::SECTION_MEMORY_SEGMENTS]) - $firstSegmentIndex,
+            ];
+        }
+    }
+
+    private function compilePropertyGroups(SimpleXMLElement $device): void
+    {
+        $propertyGroupsElement = $this->first($device, './/property-groups');
+        foreach ($this->all($propertyGroupsElement, './/property-group') as $propertyGroupElement) {
+            $firstPropertyIndex = count($this->sections[self::SECTION_PROPERTIES]);
+
+            foreach ($this->all($propertyGroupElement, './/property') as $propertyElement) {
+                $this->sections[self::SECTION_PROPERTIES][] = [
+                    ...$this->stringReference($this->lower((string) $propertyElement['name'])),
+                    ...$this->stringReference((string) $propertyElement['name']),
+                    ...$this->stringReference((string) $propertyElement['value']),
+                ];
+            }
+
+            $this->sections[self::SECTION_PROPERTY_GROUPS][] = [
+                ...$this->stringReference($this->lower((string) $propertyGroupElement['name'])),
+                $firstPropertyIndex,
+                count($this->sections[self::SECTION_PROPERTIES]) - $firstPropertyIndex,
+            ];
+        }
+    }
+
+    private function compileModules(SimpleXMLElement $xml): void
+    {
+        $modulesElement = $this->first($xml, '//modules');
+        foreach ($this->all($modulesElement, './/module') as $moduleElement) {
+            [$firstRegisterGroupIndex, $registerGroupCount] = $this->compileRegisterGroups($moduleElement);
+
+            $this->sections[self::SECTION_MODULES][] = [
+                ...$this->stringReference($this->lower((string) $moduleElement['name'])),
+                $firstRegisterGroupIndex,
+                $registerGroupCount,
+                0,
+                0,
+            ];
+        }
+    }
+
+    private function compilePeripheralModules(SimpleXMLElement $device): void
+    {
+        $peripheralsElement = $this->first($device, './/peripherals');
+        foreach ($this->all($peripheralsElement, './/module') as $moduleElement) {
+            [$firstRegisterGroupIndex, $registerGroupCount] = $this->compileRegisterGroups($moduleElement);
+            $firstInstanceIndex = count($this->sections[self::SECTION_MODULE_INSTANCES]);
+
+            foreach ($this->all($moduleElement, './/instance') as $instanceElement) {
+                [$firstInstanceRegisterGroupIndex, $instanceRegisterGroupCount] = $this->compileRegisterGroups(
+                    $instanceElement
+                );
+
+                $firstSignalIndex = count($this->sections[self::SECTION_SIGNALS]);
+
+                $signalsElement = $this->first($instanceElement, './/signals');
+                foreach ($this->all($signalsElement, './/signal') as $signalElement) {
+                    if (!isset($signalElement['pad'])) {
+                        continue;
+                    }
+
+                    $index = $this->toInteger((string) $signalElement['index'], 10, -0x80000000, 0x7FFFFFFF);
+
+                    $this->sections[self::SECTION_SIGNALS][] = [
+                        ...$this->stringReference($this->lower((string) $signalElement['pad'])),
+                        ...$this->stringReference((string) $signalElement['function']),
+                        ...$this->stringReference((string) $signalElement['group']),
+                        $index !== null ? 1 : 0,
+                        $index ?? 0,
+                    ];
+                }
+
+                $this->sections[self::SECTION_MODULE_INSTANCES][] = [
+                    ...$this->stringReference($this->lower((string) $instanceElement['name'])),
+                    $firstInstanceRegisterGroupIndex,
+                    $instanceRegisterGroupCount,
+                    $firstSignalIndex,
+                    count($this->sections[self::SECTION_SIGNALS]) - $firstSignalIndex,
+                ];
+            }
+
+            $this->sections[self::SECTION_PERIPHERAL_MODULES][] = [
+                ...$this->stringReference($this->lower((string) $moduleElement['name'])),
+                $firstRegisterGroupIndex,
+                $registerGroupCount,
+                $firstInstanceIndex,
+                count($this->sections[self::SECTION_MODULE_INSTANCES]) - $firstInstanceIndex,
+            ];
+        }
+    }
+
+    /**
+     * Compiles all register groups beneath the given element.
+     *
+     * Bloom fails to load the TDF if it encounters an invalid register group, so we do the same.
+     *
+     * @param SimpleXMLElement $element
+     * @return int[]
+     *  The index of the first register group record, and the number of register group records.
+     */
+    private function compileRegisterGroups(SimpleXMLElement $element): array
+    {
+        $firstRegisterGroupIndex = count($this->sections[self::SECTION_REGISTER_GROUPS]);
+
+        foreach ($this->all($element, './/register-group') as $registerGroupElement) {
+            $name = $this->lower((string) $registerGroupElement['name']);
+            if ($name === '') {
+                throw new Exception("Missing or empty register group name");
+            }
+
+            $firstRegisterIndex = count($this->sections[self::SECTION_REGISTERS]);
+
+            foreach ($this->all($registerGroupElement, './/register') as $registerElement) {
+                $this->compileRegister($registerElement);
+            }
+
+            $offset = isset($registerGroupElement['offset'])
+                ? $this->toInteger((string) $registerGroupElement['offset'], 16, -0x80000000, 0x7FFFFFFF) ?? 0
+                : null;
+
+            $this->sections[self::SECTION_REGISTER_GROUPS][] = [
+                ...$this->stringReference($name),
+                ...$this->stringReference(
+                    isset($registerGroupElement['name-in-module'])
+                        ? $this->lower((string) $registerGroupElement['name-in-module'])
+                        : null
+                ),
+                ...$this->stringReference(
+                    isset($registerGroupElement['address-space'])
+                        ? $this->lower((string) $registerGroupElement['address-space'])
+                        : null
+                ),
+                $offset !== null ? 1 : 0,
+                // Bloom truncates the offset to 16 bits
+                ($offset ?? 0) & 0xFFFF,
+                $firstRegisterIndex,
+                count($this->sections[self::SECTION_REGISTERS]) - $firstRegisterIndex,
+            ];
+        }
+
+        return [
+            $firstRegisterGroupIndex,
+            count($this->sections[self::SECTION_REGISTER_GROUPS]) - $firstRegisterGroupIndex,
+        ];
+    }
+
+    private function compileRegister(SimpleXMLElement $registerElement): void
+    {
+        $name = $this->lower((string) $registerElement['name']);
+        if ($name === '' || !isset($registerElement['offset']) || !isset($registerElement['size'])) {
+            return;
+        }
+
+        $offset = $this->toInteger((string) $registerElement['offset'], 16, 0, 0xFFFF);
+        if ($offset === null) {
+            return;
+        }
+
+        $readWriteAccess = null;
+        if (isset($registerElement['ocd-rw'])) {
+            $readWriteAccess = $this->lower((string) $registerElement['ocd-rw']);
+
+        } else if (isset($registerElement['rw'])) {
+            $readWriteAccess = $this->lower((string) $registerElement['rw']);
+        }
+
+        $firstBitFieldIndex = count($this->sections[self::SECTION_BIT_FIELDS]);
+
+        foreach ($this->all($registerElement, './/bitfield') as $bitFieldElement) {
+            $bitFieldName = $this->lower((string) $bitFieldElement['name']);
+            if ($bitFieldName === '' || !isset($bitFieldElement['mask'])) {
+                continue;
+            }
+
+            $mask = $this->toInteger((string) $bitFieldElement['mask'], 16, 0, 0xFFFF);
+            if ($mask === null) {
+                continue;
+            }
+
+            $this->sections[self::SECTION_BIT_FIELDS][] = [
+                ...$this->stringReference($bitFieldName),
+                // Bloom truncates the mask to 8 bits
+                $mask & 0xFF,
+            ];
+        }
+
+        $this->sections[self::SECTION_REGISTERS][] = [
+            ...$this->stringReference($name),
+            ...$this->stringReference(
+                isset($registerElement['caption']) ? (string) $registerElement['caption'] : null
+            ),
+            ...$this->stringReference($readWriteAccess),
+            $offset,
+            $this->toInteger((string) $registerElement['size'], 10, 0, 0xFFFF) ?? 0,
+            $firstBitFieldIndex,
+            count($this->sections[self::SECTION_BIT_FIELDS]) - $firstBitFieldIndex,
+        ];
+    }
+
+    private function compileVariants(SimpleXMLElement $xml): void
+    {
+        $variantsElement = $this->first($xml, '//variants');
+        foreach ($this->all($variantsElement, './/variant') as $variantElement) {
+            if (
+                !isset($variantElement['ordercode'])
+                || !isset($variantElement['package'])
+                || !isset($variantElement['pinout'])
+            ) {
+                continue;
+            }
+
+            $this->sections[self::SECTION_VARIANTS][] = [
+                ...$this->stringReference((string) $variantElement['ordercode']),
+                ...$this->stringReference($this->lower((string) $variantElement['pinout'])),
+                ...$this->stringReference(strtoupper((string) $variantElement['package'])),
+                (string) $variantElement['disabled'] === '1' ? 1 : 0,
+            ];
+        }
+    }
+
+    private function compilePinouts(SimpleXMLElement $xml): void
+    {
+        $pinoutsElement = $this->first($xml, '//pinouts');
+        foreach ($this->all($pinoutsElement, './/pinout') as $pinoutElement) {
+            if (!isset($pinoutElement['name'])) {
+                continue;
+            }
+
+            $pins = [];
+            foreach ($this->all($pinoutElement, './/pin') as $pinElement) {
+                $position = isset($pinElement['pad'])
+                    ? $this->toInteger((string) $pinElement['position'], 10, -0x80000000, 0x7FFFFFFF)
+                    : null;
+
+                if ($position === null) {
+                    // Bloom discards the whole pinout if any of its pins are invalid
+                    continue 2;
+                }
+
+                $pins[] = [...$this->stringReference($this->lower((string) $pinElement['pad'])), $position];
+            }
+
+            $firstPinIndex = count($this->sections[self::SECTION_PINS]);
+            array_push($this->sections[self::SECTION_PINS], ...$pins);
+
+            $this->sections[self::SECTION_PINOUTS][] = [
+                ...$this->stringReference($this->lower((string) $pinoutElement['name'])),
+                $firstPinIndex,
+                count($pins),
+            ];
+        }
+    }
+
+    private function compileInterfaces(SimpleXMLElement $device): void
+    {
+        $interfacesElement = $this->first($device, './/interfaces');
+        foreach ($this->all($interfacesElement, './/interface') as $interfaceElement) {
+            if (!isset($interfaceElement['name'])) {
+                continue;
+            }
+
+            $this->sections[self::SECTION_INTERFACES][] = [
+                ...$this->stringReference($this->lower((string) $interfaceElement['name'])),
+                ...$this->stringReference(
+                    isset($interfaceElement['type']) ? (string) $interfaceElement['type'] : null
+                ),
+            ];
+        }
+    }
+
+    /**
+     * Returns the offset and length of the given string, in the string section, adding it if necessary.
+     *
+     * @param string|null $value
+     * @return int[]
+     */
+    private function stringReference(?string $value): array
+    {
+        if ($value === null) {
+            return [self::NULL_STRING, 0];
+        }
+
+        if (!isset($this->stringOffsets[$value])) {
+            $this->stringOffsets[$value] = strlen($this->strings);
+            $this->strings .= $value;
+        }
+
+        return [$this->stringOffsets[$value], strlen($value)];
+    }
+
+    /**
+     * Converts a string to an integer, in the same way as Qt's QString::toInt() (and friends).
+     *
+     * @param string $value
+     * @param int $base
+     * @param int $min
+     * @param int $max
+     * @return int|null
+     *  Null if the conversion failed.
+     */
+    private function toInteger(string $value, int $base, int $min, int $max): ?int
+    {
+        $value = trim($value);
+        $negative = false;
+
+        if ($value !== '' && ($value[0] === '-' || $value[0] === '+')) {
+            $negative = $value[0] === '-';
+            $value = substr($value, 1);
+        }
+
+        if ($base === 16 && (str_starts_with($value, '0x') || str_starts_with($value, '0X'))) {
+            $value = substr($value, 2);
+        }
+
+        if (
+            $value === ''
+            || ($base === 16 && !ctype_xdigit($value))
+            || ($base === 10 && !ctype_digit($value))
+        ) {
+            return null;
+        }
+
+        $integer = intval($value, $base);
+        if ($negative) {
+            $integer = -$integer;
+        }
+
+        // Values that are too large for PHP's integers will have been clamped to PHP_INT_MAX, which exceeds $max
+        return ($integer < $min || $integer > $max) ? null : $integer;
+    }
+
+    /**
+     * TDFs only contain ASCII, so there's no need for the mbstring extension, here.
+     *
+     * @param string $value
+     * @return string
+     */
+    private function lower(string $value): string
+    {
+        return strtolower($value);
+    }
+
+    private function first(?SimpleXMLElement $element, string $xpath): ?SimpleXMLElement
+    {
+        return $this->all($element, $xpath)[0] ?? null;
+    }
+
+    /**
+     * @param SimpleXMLElement|null $element
+     * @param string $xpath
+     * @return SimpleXMLElement[]
+     */
+    private function all(?SimpleXMLElement $element, string $xpath): array
+    {
+        if ($element === null) {
+            return [];
+        }
+
+        $result = $element->xpath($xpath);
+        return is_array($result) ? $result : [];
+    }
+
+    private function pack(array $words): string
+    {
+        return pack('V*', ...array_map(fn (int $word): int => $word & 0xFFFFFFFF, $words));
+    }
+}
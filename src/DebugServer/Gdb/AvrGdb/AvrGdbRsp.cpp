@@ -1,5 +1,8 @@
 #include "AvrGdbRsp.hpp"
 
+#include <array>
+#include <algorithm>
+
 #include "src/Services/StringService.hpp"
 
 // Command packets
@@ -9,6 +12,7 @@
 #include "CommandPackets/ReadMemory.hpp"
 #include "CommandPackets/WriteMemory.hpp"
 #include "CommandPackets/ReadMemoryMap.hpp"
+#include "CommandPackets/MemoryCrcQuery.hpp"
 #include "CommandPackets/FlashErase.hpp"
 #include "CommandPackets/FlashWrite.hpp"
 #include "CommandPackets/FlashDone.hpp"
@@ -16,6 +20,9 @@
 #include "CommandPackets/VContContinueExecution.hpp"
 #include "CommandPackets/VContStepExecution.hpp"
 #include "CommandPackets/VContRangeStep.hpp"
+#include "CommandPackets/AnalyseProgram.hpp"
+
+#include "src/DebugServer/Gdb/CommandPackets/Monitor.hpp"
 
 namespace DebugServer::Gdb::AvrGdb
 {
@@ -33,6 +40,18 @@ namespace DebugServer::Gdb::AvrGdb
         , gdbTargetDescriptor(TargetDescriptor(this->targetControllerService.getTargetDescriptor()))
     {}
 
+    void AvrGdbRsp::init() {
+        GdbRspDebugServer::init();
+
+        this->eventListener.registerCallbackForEventType<Events::MemoryWrittenToTarget>(
+            std::bind(&AvrGdbRsp::onTargetMemoryWritten, this, std::placeholders::_1)
+        );
+
+        this->eventListener.registerCallbackForEventType<Events::ProgrammingModeEnabled>(
+            std::bind(&AvrGdbRsp::onProgrammingModeEnabled, this, std::placeholders::_1)
+        );
+    }
+
     DebugSession* AvrGdbRsp::startDebugSession(Connection&& connection) {
         this->activeDebugSession.emplace(
             std::move(connection),
@@ -45,6 +64,18 @@ namespace DebugServer::Gdb::AvrGdb
     }
 
     void AvrGdbRsp::endDebugSession() {
+        if (this->activeDebugSession.has_value()) {
+            try {
+                this->activeDebugSession->terminateRangeSteppingSession();
+                this->activeDebugSession->removeAllBreakpoints(this->targetControllerService);
+
+            } catch (const Exception& exception) {
+                Logger::error(
+                    "Failed to remove breakpoints at the end of the debug session - " + exception.getMessage()
+                );
+            }
+        }
+
         this->activeDebugSession.reset();
     }
 
@@ -65,6 +96,7 @@ namespace DebugServer::Gdb::AvrGdb
         using AvrGdb::CommandPackets::ReadMemory;
         using AvrGdb::CommandPackets::WriteMemory;
         using AvrGdb::CommandPackets::ReadMemoryMap;
+        using AvrGdb::CommandPackets::MemoryCrcQuery;
         using AvrGdb::CommandPackets::FlashErase;
         using AvrGdb::CommandPackets::FlashWrite;
         using AvrGdb::CommandPackets::FlashDone;
@@ -72,6 +104,7 @@ namespace DebugServer::Gdb::AvrGdb
         using AvrGdb::CommandPackets::VContContinueExecution;
         using AvrGdb::CommandPackets::VContStepExecution;
         using AvrGdb::CommandPackets::VContRangeStep;
+        using AvrGdb::CommandPackets::AnalyseProgram;
 
         if (rawPacket.size() >= 2) {
             if (rawPacket[1] == 'p') {
@@ -86,11 +119,11 @@ namespace DebugServer::Gdb::AvrGdb
                 return std::make_unique<WriteRegister>(rawPacket);
             }
 
-            if (rawPacket[1] == 'm') {
+            if (rawPacket[1] == 'm' || rawPacket[1] == 'x') {
                 return std::make_unique<ReadMemory>(rawPacket, this->gdbTargetDescriptor);
             }
 
-            if (rawPacket[1] == 'M') {
+            if (rawPacket[1] == 'M' || rawPacket[1] == 'X') {
                 return std::make_unique<WriteMemory>(rawPacket, this->gdbTargetDescriptor);
             }
 
@@ -100,6 +133,10 @@ namespace DebugServer::Gdb::AvrGdb
                 return std::make_unique<ReadMemoryMap>(rawPacket);
             }
 
+            if (rawPacketString.find("qCRC:") == 0) {
+                return std::make_unique<MemoryCrcQuery>(rawPacket, this->gdbTargetDescriptor);
+            }
+
             if (rawPacketString.find("vFlashErase") == 0) {
                 return std::make_unique<FlashErase>(rawPacket);
             }
@@ -126,7 +163,20 @@ namespace DebugServer::Gdb::AvrGdb
 
             if (this->debugServerConfig.rangeStepping) {
                 if (rawPacketString.find("vCont;r") == 0) {
-                    return std::make_unique<VContRangeStep>(rawPacket);
+                    return std::make_unique<VContRangeStep>(
+                        rawPacket,
+                        this->rangeSteppingAnalysisCache,
+                        this->programAnalysisService
+                    );
+                }
+            }
+
+            if (rawPacketString.find("qRcmd") == 0) {
+                // This is a monitor packet
+                auto monitorCommand = Gdb::CommandPackets::Monitor(rawPacket);
+
+                if (monitorCommand.command == "analyse") {
+                    return std::make_unique<AnalyseProgram>(std::move(monitorCommand), this->programAnalysisService);
                 }
             }
         }
@@ -139,6 +189,7 @@ namespace DebugServer::Gdb::AvrGdb
             {Feature::SOFTWARE_BREAKPOINTS, std::nullopt},
             {Feature::MEMORY_MAP_READ, std::nullopt},
             {Feature::VCONT_ACTIONS_QUERY, std::nullopt},
+            {Feature::NO_ACK_MODE, std::nullopt},
         };
     }
 
@@ -159,7 +210,7 @@ namespace DebugServer::Gdb::AvrGdb
              *
              * We need to figure out why, and determine whether the stop should be reported to GDB.
              */
-            if (this->activeDebugSession->externalBreakpointsByAddress.contains(programAddress)) {
+            if (this->activeDebugSession->externalBreakpointAddresses.contains(programAddress)) {
                 /*
                  * The target stopped due to an external breakpoint, set by GDB.
                  *
@@ -167,7 +218,7 @@ namespace DebugServer::Gdb::AvrGdb
                  */
                 Logger::debug("Reached external breakpoint within stepping range");
 
-                this->activeDebugSession->terminateRangeSteppingSession(this->targetControllerService);
+                this->activeDebugSession->terminateRangeSteppingSession();
                 return GdbRspDebugServer::handleTargetStoppedGdbResponse(programAddress);
             }
 
@@ -213,11 +264,96 @@ namespace DebugServer::Gdb::AvrGdb
              */
             Logger::debug("Target stopped within stepping range, but for an unknown reason");
 
-            this->activeDebugSession->terminateRangeSteppingSession(this->targetControllerService);
+            this->activeDebugSession->terminateRangeSteppingSession();
             return GdbRspDebugServer::handleTargetStoppedGdbResponse(programAddress);
         }
 
         // Report the stop to GDB
         return GdbRspDebugServer::handleTargetStoppedGdbResponse(programAddress);
     }
+
+    std::map<GdbRegisterId, std::vector<unsigned char>> AvrGdbRsp::getExpeditedRegisters(
+        Targets::TargetMemoryAddress programAddress
+    ) {
+        static constexpr auto EXPEDITED_GDB_REGISTER_IDS = std::array<GdbRegisterId, 4>({
+            28,
+            29,
+            TargetDescriptor::STATUS_GDB_REGISTER_ID,
+            TargetDescriptor::STACK_POINTER_GDB_REGISTER_ID,
+        });
+
+        auto output = std::map<GdbRegisterId, std::vector<unsigned char>>();
+
+        // The program counter isn't accessed like other registers - we take it from the stop event
+        output.emplace(
+            TargetDescriptor::PROGRAM_COUNTER_GDB_REGISTER_ID,
+            std::vector<unsigned char>({
+                static_cast<unsigned char>(programAddress),
+                static_cast<unsigned char>(programAddress >> 8),
+                static_cast<unsigned char>(programAddress >> 16),
+                static_cast<unsigned char>(programAddress >> 24),
+            })
+        );
+
+        auto descriptorIds = Targets::TargetRegisterDescriptorIds();
+        for (const auto gdbRegisterId : EXPEDITED_GDB_REGISTER_IDS) {
+            const auto descriptorId = this->gdbTargetDescriptor.getTargetRegisterDescriptorIdFromGdbRegisterId(
+                gdbRegisterId
+            );
+
+            if (descriptorId.has_value()) {
+                descriptorIds.insert(*descriptorId);
+            }
+        }
+
+        try {
+            // All of the registers are read via a single TargetController command
+            auto registers = this->targetControllerService.readRegisters(descriptorIds);
+
+            for (auto& reg : registers) {
+                const auto gdbRegisterId = this->gdbTargetDescriptor.getGdbRegisterIdFromTargetRegisterDescriptorId(
+                    reg.descriptorId
+                );
+
+                if (!gdbRegisterId.has_value()) {
+                    continue;
+                }
+
+                const auto& gdbRegisterDescriptor = this->gdbTargetDescriptor.gdbRegisterDescriptorsById.at(
+                    *gdbRegisterId
+                );
+
+                // Register values are in MSB form, but GDB expects them in LSB
+                std::reverse(reg.value.begin(), reg.value.end());
+
+                if (reg.value.size() < gdbRegisterDescriptor.size) {
+                    reg.value.insert(reg.value.end(), (gdbRegisterDescriptor.size - reg.value.size()), 0x00);
+                }
+
+                output.emplace(*gdbRegisterId, std::move(reg.value));
+            }
+
+        } catch (const Exception& exception) {
+            /*
+             * This isn't fatal - GDB will just request the registers if we don't include them in the stop reply.
+             */
+            Logger::warning("Failed to read expedited registers - " + exception.getMessage());
+        }
+
+        return output;
+    }
+
+    void AvrGdbRsp::onTargetMemoryWritten(const Events::MemoryWrittenToTarget& event) {
+        if (event.memoryType != this->gdbTargetDescriptor.targetDescriptor.programMemoryType) {
+            return;
+        }
+
+        this->rangeSteppingAnalysisCache.invalidate(event.startAddress, event.size);
+        this->programAnalysisService.invalidateCurrentAnalysis();
+    }
+
+    void AvrGdbRsp::onProgrammingModeEnabled(const Events::ProgrammingModeEnabled&) {
+        this->rangeSteppingAnalysisCache.clear();
+        this->programAnalysisService.invalidateCurrentAnalysis();
+    }
 }
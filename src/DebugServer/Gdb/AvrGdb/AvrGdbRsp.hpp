@@ -4,9 +4,15 @@
 
 #include "TargetDescriptor.hpp"
 #include "DebugSession.hpp"
+#include "RangeSteppingAnalysisCache.hpp"
+
+#include "src/Services/Avr8ProgramAnalysisService.hpp"
 
 #include "src/DebugServer/Gdb/GdbRspDebugServer.hpp"
 
+#include "src/EventManager/Events/MemoryWrittenToTarget.hpp"
+#include "src/EventManager/Events/ProgrammingModeEnabled.hpp"
+
 namespace DebugServer::Gdb::AvrGdb
 {
     class AvrGdbRsp: public GdbRspDebugServer
@@ -22,6 +28,8 @@ namespace DebugServer::Gdb::AvrGdb
             return "AVR GDB Remote Serial Protocol Debug Server";
         }
 
+        void init() override;
+
     protected:
         DebugSession* startDebugSession(Connection&& connection) override;
 
@@ -47,6 +55,17 @@ namespace DebugServer::Gdb::AvrGdb
 
         void handleTargetStoppedGdbResponse(Targets::TargetMemoryAddress programAddress) override;
 
+        /**
+         * For AVR targets, we expedite the program counter, the stack pointer, the status register and the Y register
+         * (r28 and r29), which avr-gdb uses as the frame pointer.
+         *
+         * @param programAddress
+         * @return
+         */
+        std::map<GdbRegisterId, std::vector<unsigned char>> getExpeditedRegisters(
+            Targets::TargetMemoryAddress programAddress
+        ) override;
+
     private:
         TargetDescriptor gdbTargetDescriptor;
 
@@ -55,5 +74,31 @@ namespace DebugServer::Gdb::AvrGdb
          * held here. A value of std::nullopt means there is no active debug session present.
          */
         std::optional<DebugSession> activeDebugSession;
+
+        /**
+         * Results of the program flow analysis performed for range stepping sessions.
+         *
+         * See RangeSteppingAnalysisCache and VContRangeStep::handle() for more.
+         */
+        RangeSteppingAnalysisCache rangeSteppingAnalysisCache;
+
+        /**
+         * Holds the results of the "monitor analyse" command. See AnalyseProgram for more.
+         */
+        Services::Avr8ProgramAnalysisService programAnalysisService;
+
+        /**
+         * Invalidates any range stepping and program analysis that depends on program memory that has been written
+         * to.
+         *
+         * @param event
+         */
+        void onTargetMemoryWritten(const Events::MemoryWrittenToTarget& event);
+
+        /**
+         * The program memory may be erased whilst the target is in programming mode, so we discard all range
+         * stepping analysis, and the current program analysis, upon entering it.
+         */
+        void onProgrammingModeEnabled(const Events::ProgrammingModeEnabled&);
     };
 }
@@ -0,0 +1,62 @@
+#include "AnalyseProgram.hpp"
+
+#include <string>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace DebugServer::Gdb::AvrGdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ErrorResponsePacket;
+    using ResponsePackets::ResponsePacket;
+
+    using ::Exceptions::Exception;
+
+    AnalyseProgram::AnalyseProgram(
+        Monitor&& monitorPacket,
+        Services::Avr8ProgramAnalysisService& programAnalysisService
+    )
+        : Monitor(std::move(monitorPacket))
+        , programAnalysisService(programAnalysisService)
+    {}
+
+    void AnalyseProgram::handle(Gdb::DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling AnalyseProgram packet");
+
+        try {
+            const auto analysis = this->programAnalysisService.analyseProgramMemory(
+                debugSession.gdbTargetDescriptor.targetDescriptor,
+                targetControllerService
+            );
+
+            auto instructionCount = std::size_t{0};
+            for (const auto& record : analysis->instructions.records) {
+                if (record.decoded()) {
+                    ++instructionCount;
+                }
+            }
+
+            auto output = std::string("Program memory analysis:\n\n");
+            output += "  Analysed bytes:      " + std::to_string(analysis->instructions.records.size() * 2) + "\n";
+            output += "  Instructions:        " + std::to_string(instructionCount) + "\n";
+            output += "  Undecoded words:     " + std::to_string(analysis->undecodedWordCount) + "\n";
+            output += "  Basic blocks:        " + std::to_string(analysis->basicBlocksByStartAddress.size()) + "\n";
+            output += "  Call destinations:   " + std::to_string(analysis->callSiteAddressesByCallee.size()) + "\n";
+            output += "  Branch destinations: " + std::to_string(analysis->branchSourceAddressesByTarget.size())
+                + "\n";
+
+            debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(output)));
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to analyse program memory - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
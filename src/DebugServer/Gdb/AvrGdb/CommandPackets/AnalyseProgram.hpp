@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+#include "src/DebugServer/Gdb/CommandPackets/Monitor.hpp"
+
+#include "src/Services/Avr8ProgramAnalysisService.hpp"
+
+namespace DebugServer::Gdb::AvrGdb::CommandPackets
+{
+    /**
+     * The AnalyseProgram class implements a structure for the "monitor analyse" GDB command.
+     *
+     * We decode the target's entire program memory, perform static control flow analysis on it and output a summary
+     * of the results. The analysis is kept for subsequent range stepping sessions, which will use it in place of
+     * reading and decoding the stepping range from the target. See VContRangeStep::resolveInterceptedAddresses().
+     */
+    class AnalyseProgram: public Gdb::CommandPackets::Monitor
+    {
+    public:
+        explicit AnalyseProgram(Monitor&& monitorPacket, Services::Avr8ProgramAnalysisService& programAnalysisService);
+
+        void handle(
+            Gdb::DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+
+    private:
+        Services::Avr8ProgramAnalysisService& programAnalysisService;
+    };
+}
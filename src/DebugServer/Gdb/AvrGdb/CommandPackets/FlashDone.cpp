@@ -1,5 +1,7 @@
 #include "FlashDone.hpp"
 
+#include <chrono>
+
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
 
@@ -24,19 +26,33 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
 
         try {
             if (debugSession.programmingSession.has_value()) {
-                const auto& programmingSession = debugSession.programmingSession.value();
+                auto& programmingSession = debugSession.programmingSession.value();
                 Logger::info(
-                    "Flushing " + std::to_string(programmingSession.buffer.size()) + " bytes to target's program memory"
+                    "Flushing remaining " + std::to_string(programmingSession.buffer.size())
+                        + " bytes to target's program memory"
                 );
 
-                targetControllerService.enableProgrammingMode();
+                programmingSession.complete(targetControllerService);
 
-                targetControllerService.writeMemory(
-                    Targets::TargetMemoryType::FLASH,
-                    programmingSession.startAddress,
-                    std::move(programmingSession.buffer)
+                const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - programmingSession.startTime
                 );
 
+                Logger::info(
+                    "Programmed " + std::to_string(programmingSession.totalBytes) + " bytes in "
+                        + std::to_string(duration.count()) + "ms"
+                        + (
+                            duration.count() > 0
+                                ? " (" + std::to_string(programmingSession.totalBytes / duration.count())
+                                    + " bytes/ms)"
+                                : ""
+                        )
+                );
+
+                if (programmingSession.skippedBytes > 0) {
+                    Logger::info("Skipped " + std::to_string(programmingSession.skippedBytes) + " unchanged bytes");
+                }
+
                 debugSession.programmingSession.reset();
             }
 
@@ -51,7 +67,7 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
 
         } catch (const Exception& exception) {
             Logger::error("Failed to handle FlashDone packet - " + exception.getMessage());
-            debugSession.programmingSession.reset();
+            debugSession.terminateProgrammingSession(targetControllerService);
 
             try {
                 targetControllerService.disableProgrammingMode();
@@ -1,5 +1,7 @@
 #include "FlashErase.hpp"
 
+#include <QString>
+
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
 
@@ -52,18 +54,25 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
         Logger::info("Handling FlashErase packet");
 
         try {
-            targetControllerService.enableProgrammingMode();
-
-            Logger::warning("Erasing program memory, in preparation for programming");
+            if (!debugSession.programmingSession.has_value()) {
+                const auto& targetDescriptor = debugSession.gdbTargetDescriptor.targetDescriptor;
+                debugSession.programmingSession = ProgrammingSession(
+                    targetDescriptor.memoryDescriptorsByType.at(targetDescriptor.programMemoryType),
+                    debugSession.serverConfig.differentialProgramming
+                );
+            }
 
-            // We don't erase a specific address range - we just erase the entire program memory.
-            targetControllerService.eraseMemory(debugSession.gdbTargetDescriptor.targetDescriptor.programMemoryType);
+            /*
+             * We don't erase a specific address range - we just erase the entire program memory. In differential
+             * mode, the programming session may defer the erase, or skip it entirely.
+             */
+            debugSession.programmingSession->erase(targetControllerService);
 
             debugSession.connection.writePacket(OkResponsePacket());
 
         } catch (const Exception& exception) {
             Logger::error("Failed to erase flash memory - " + exception.getMessage());
-            debugSession.programmingSession.reset();
+            debugSession.terminateProgrammingSession(targetControllerService);
 
             try {
                 targetControllerService.disableProgrammingMode();
@@ -1,10 +1,11 @@
 #include "FlashWrite.hpp"
 
-#include <QByteArray>
+#include <string_view>
 
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
 
+#include "src/Services/StringService.hpp"
 #include "src/Logger/Logger.hpp"
 #include "src/Exceptions/Exception.hpp"
 
@@ -35,14 +36,14 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
             throw Exception("Failed to find colon delimiter in write flash packet.");
         }
 
-        bool conversionStatus = false;
-        this->startAddress = QByteArray(
-            reinterpret_cast<const char*>(this->data.data() + 12),
-            std::distance(this->data.begin(), colonIt) - 12
-        ).toUInt(&conversionStatus, 16);
+        try {
+            this->startAddress = Services::StringService::uint32FromHex(std::string_view(
+                reinterpret_cast<const char*>(this->data.data() + 12),
+                static_cast<std::size_t>(std::distance(this->data.begin(), colonIt) - 12)
+            ));
 
-        if (!conversionStatus) {
-            throw Exception("Failed to parse start address from flash write packet data");
+        } catch (const Exception& exception) {
+            throw Exception("Failed to parse start address from flash write packet data - " + exception.getMessage());
         }
 
         this->buffer = Targets::TargetMemoryBuffer(colonIt + 1, this->data.end());
@@ -57,38 +58,31 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
             }
 
             if (!debugSession.programmingSession.has_value()) {
-                debugSession.programmingSession = ProgrammingSession(this->startAddress, this->buffer);
-
-            } else {
-                auto& programmingSession = debugSession.programmingSession.value();
-                const auto currentEndAddress = programmingSession.startAddress + programmingSession.buffer.size() - 1;
-                const auto expectedStartAddress = (currentEndAddress + 1);
-
-                if (this->startAddress < expectedStartAddress) {
-                    throw Exception("Invalid start address from GDB - the buffer would overlap a previous buffer");
-                }
-
-                if (this->startAddress > expectedStartAddress) {
-                    // There is a gap in the buffer sent by GDB. Fill it with 0xFF
-                    programmingSession.buffer.insert(
-                        programmingSession.buffer.end(),
-                        this->startAddress - expectedStartAddress,
-                        0xFF
-                    );
-                }
-
-                programmingSession.buffer.insert(
-                    programmingSession.buffer.end(),
-                    this->buffer.begin(),
-                    this->buffer.end()
+                /*
+                 * GDB usually sends a FlashErase packet before any FlashWrite packets, which would have started the
+                 * programming session.
+                 */
+                const auto& targetDescriptor = debugSession.gdbTargetDescriptor.targetDescriptor;
+                debugSession.programmingSession = ProgrammingSession(
+                    targetDescriptor.memoryDescriptorsByType.at(targetDescriptor.programMemoryType),
+                    debugSession.serverConfig.differentialProgramming
                 );
             }
 
+            auto& programmingSession = debugSession.programmingSession.value();
+            programmingSession.appendData(this->startAddress, this->buffer);
+
+            /*
+             * Hand any complete pages over to the TargetController now, so that they can be written to the target
+             * whilst we wait for GDB to send the next FlashWrite packet.
+             */
+            programmingSession.writeCompletePages(targetControllerService);
+
             debugSession.connection.writePacket(OkResponsePacket());
 
         } catch (const Exception& exception) {
             Logger::error("Failed to handle FlashWrite packet - " + exception.getMessage());
-            debugSession.programmingSession.reset();
+            debugSession.terminateProgrammingSession(targetControllerService);
 
             try {
                 targetControllerService.disableProgrammingMode();
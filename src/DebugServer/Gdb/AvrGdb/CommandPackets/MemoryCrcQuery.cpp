@@ -0,0 +1,135 @@
+#include "MemoryCrcQuery.hpp"
+
+#include <array>
+#include <string_view>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace DebugServer::Gdb::AvrGdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ErrorResponsePacket;
+    using ResponsePackets::ResponsePacket;
+
+    using Exceptions::Exception;
+
+    namespace
+    {
+        /**
+         * GDB's CRC-32 (see xcrc32() in libiberty) uses the 0x04C11DB7 polynomial, without reflection or a final XOR.
+         */
+        constexpr auto CRC_TABLE = [] {
+            auto table = std::array<std::uint32_t, 256>();
+
+            for (auto i = std::uint32_t{0}; i < 256; ++i) {
+                auto crc = i << 24;
+
+                for (auto bit = 0; bit < 8; ++bit) {
+                    crc = (crc & 0x80000000) != 0 ? (crc << 1) ^ 0x04C11DB7 : (crc << 1);
+                }
+
+                table[i] = crc;
+            }
+
+            return table;
+        }();
+
+        std::uint32_t crc32(const Targets::TargetMemoryBuffer& data) {
+            auto crc = std::uint32_t{0xFFFFFFFF};
+
+            for (const auto byte : data) {
+                crc = (crc << 8) ^ CRC_TABLE[((crc >> 24) ^ byte) & 0xFF];
+            }
+
+            return crc;
+        }
+    }
+
+    MemoryCrcQuery::MemoryCrcQuery(const RawPacket& rawPacket, const TargetDescriptor& gdbTargetDescriptor)
+        : CommandPacket(rawPacket)
+    {
+        if (this->data.size() < 8) {
+            throw Exception("Invalid packet length");
+        }
+
+        /*
+         * The packet consists of two segments, an address and a length, separated by a comma character.
+         */
+        const auto packetData = std::string_view(
+            reinterpret_cast<const char*>(this->data.data() + 5), // +5 to exclude the "qCRC:"
+            this->data.size() - 5
+        );
+
+        const auto delimiterPosition = packetData.find(',');
+        if (delimiterPosition == std::string_view::npos) {
+            throw Exception("Missing delimiter in qCRC packet data");
+        }
+
+        const auto gdbStartAddress = Services::StringService::uint32FromHex(packetData.substr(0, delimiterPosition));
+
+        this->memoryType = gdbTargetDescriptor.getMemoryTypeFromGdbAddress(gdbStartAddress);
+        this->startAddress = gdbStartAddress & ~(gdbTargetDescriptor.getMemoryOffset(this->memoryType));
+
+        this->bytes = Services::StringService::uint32FromHex(packetData.substr(delimiterPosition + 1));
+    }
+
+    void MemoryCrcQuery::handle(Gdb::DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling MemoryCrcQuery packet");
+
+        try {
+            const auto& memoryDescriptorsByType =
+                debugSession.gdbTargetDescriptor.targetDescriptor.memoryDescriptorsByType;
+            const auto memoryDescriptorIt = memoryDescriptorsByType.find(this->memoryType);
+
+            if (memoryDescriptorIt == memoryDescriptorsByType.end()) {
+                throw Exception("Target does not support the requested memory type.");
+            }
+
+            const auto& memoryDescriptor = memoryDescriptorIt->second;
+
+            if (this->memoryType == Targets::TargetMemoryType::EEPROM) {
+                // GDB sends EEPROM addresses in relative form - we convert them to absolute form, here.
+                this->startAddress = memoryDescriptor.addressRange.startAddress + this->startAddress;
+            }
+
+            const auto permittedStartAddress = (this->memoryType == Targets::TargetMemoryType::RAM)
+                ? 0x00
+                : memoryDescriptor.addressRange.startAddress;
+
+            // We avoid computing the end address here, as (startAddress + bytes - 1) can overflow
+            if (
+                this->bytes > 0
+                && (
+                    this->startAddress < permittedStartAddress
+                    || this->startAddress > memoryDescriptor.addressRange.endAddress
+                    || (this->bytes - 1) > (memoryDescriptor.addressRange.endAddress - this->startAddress)
+                )
+            ) {
+                throw Exception("GDB requested a CRC for memory which is outside the target's memory range");
+            }
+
+            /*
+             * GDB uses qCRC to verify the target's memory against the ELF (e.g. "compare-sections"), so the CRC must
+             * reflect what is actually on the target - we bypass the TargetController's memory caches.
+             */
+            const auto crc = crc32(
+                this->bytes > 0
+                    ? targetControllerService.readMemory(this->memoryType, this->startAddress, this->bytes, true)
+                    : Targets::TargetMemoryBuffer()
+            );
+
+            debugSession.connection.writePacket(ResponsePacket("C" + Services::StringService::toHex(crc)));
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to compute memory CRC - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+
+#include "src/DebugServer/Gdb/CommandPackets/CommandPacket.hpp"
+#include "src/DebugServer/Gdb/TargetDescriptor.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace DebugServer::Gdb::AvrGdb::CommandPackets
+{
+    /**
+     * The MemoryCrcQuery class implements a structure for the "qCRC:addr,length" packet. Upon receiving this packet,
+     * the server is expected to respond with the CRC-32 of the given memory range.
+     *
+     * GDB uses this packet to verify the target's memory (e.g. via the "compare-sections" command), without having to
+     * read the memory.
+     */
+    class MemoryCrcQuery: public Gdb::CommandPackets::CommandPacket
+    {
+    public:
+        /**
+         * Start address of the memory range.
+         */
+        Targets::TargetMemoryAddress startAddress = 0;
+
+        /**
+         * The type of memory to compute the CRC for.
+         */
+        Targets::TargetMemoryType memoryType = Targets::TargetMemoryType::FLASH;
+
+        /**
+         * Number of bytes in the memory range.
+         */
+        Targets::TargetMemorySize bytes = 0;
+
+        explicit MemoryCrcQuery(const RawPacket& rawPacket, const Gdb::TargetDescriptor& gdbTargetDescriptor);
+
+        void handle(
+            Gdb::DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -1,5 +1,7 @@
 #include "ReadMemory.hpp"
 
+#include <string_view>
+
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
 
@@ -24,28 +26,29 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
             throw Exception("Invalid packet length");
         }
 
-        const auto packetString = QString::fromLocal8Bit(
-            reinterpret_cast<const char*>(this->data.data() + 1),
-            static_cast<int>(this->data.size() - 1)
-        );
+        this->binary = this->data[0] == 'x';
 
         /*
-         * The read memory ('m') packet consists of two segments, an address and a number of bytes to read.
+         * The read memory ('m' and 'x') packets consist of two segments, an address and a number of bytes to read.
          * These are separated by a comma character.
          */
-        const auto packetSegments = packetString.split(",");
+        const auto packetData = std::string_view(
+            reinterpret_cast<const char*>(this->data.data() + 1),
+            this->data.size() - 1
+        );
 
-        if (packetSegments.size() != 2) {
-            throw Exception(
-                "Unexpected number of segments in packet data: " + std::to_string(packetSegments.size())
-            );
+        const auto delimiterPosition = packetData.find(',');
+        if (delimiterPosition == std::string_view::npos) {
+            throw Exception("Missing delimiter in read memory packet data");
         }
 
-        bool conversionStatus = false;
-        const auto gdbStartAddress = packetSegments.at(0).toUInt(&conversionStatus, 16);
+        auto gdbStartAddress = Targets::TargetMemoryAddress{0};
 
-        if (!conversionStatus) {
-            throw Exception("Failed to parse start address from read memory packet data");
+        try {
+            gdbStartAddress = Services::StringService::uint32FromHex(packetData.substr(0, delimiterPosition));
+
+        } catch (const Exception& exception) {
+            throw Exception("Failed to parse start address from read memory packet data - " + exception.getMessage());
         }
 
         /*
@@ -55,10 +58,11 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
         this->memoryType = gdbTargetDescriptor.getMemoryTypeFromGdbAddress(gdbStartAddress);
         this->startAddress = gdbStartAddress & ~(gdbTargetDescriptor.getMemoryOffset(this->memoryType));
 
-        this->bytes = packetSegments.at(1).toUInt(&conversionStatus, 16);
+        try {
+            this->bytes = Services::StringService::uint32FromHex(packetData.substr(delimiterPosition + 1));
 
-        if (!conversionStatus) {
-            throw Exception("Failed to parse read length from read memory packet data");
+        } catch (const Exception& exception) {
+            throw Exception("Failed to parse read length from read memory packet data - " + exception.getMessage());
         }
     }
 
@@ -74,7 +78,11 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
             }
 
             if (this->bytes == 0) {
-                debugSession.connection.writePacket(ResponsePacket(std::vector<unsigned char>()));
+                debugSession.connection.writePacket(
+                    this->binary
+                        ? ResponsePacket(std::vector<unsigned char>({'b'}))
+                        : ResponsePacket(std::vector<unsigned char>())
+                );
                 return;
             }
 
@@ -148,7 +156,21 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
                 memoryBuffer.insert(memoryBuffer.end(), (this->bytes - bytesToRead), 0x00);
             }
 
-            debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(memoryBuffer)));
+            if (this->binary) {
+                /*
+                 * The memory is sent as-is, with a 'b' prefix. Any bytes that clash with the RSP framing characters
+                 * are escaped in Packet::toRawPacket().
+                 */
+                memoryBuffer.insert(memoryBuffer.begin(), 'b');
+                debugSession.connection.writePacket(ResponsePacket(memoryBuffer));
+                return;
+            }
+
+            auto responseData = std::vector<unsigned char>();
+            responseData.reserve(memoryBuffer.size() * 2);
+            Services::StringService::appendHex(memoryBuffer, responseData);
+
+            debugSession.connection.writePacket(ResponsePacket(std::move(responseData)));
 
         } catch (const Exception& exception) {
             Logger::error("Failed to read memory from target - " + exception.getMessage());
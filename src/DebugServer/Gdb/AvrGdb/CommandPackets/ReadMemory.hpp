@@ -11,8 +11,12 @@
 namespace DebugServer::Gdb::AvrGdb::CommandPackets
 {
     /**
-     * The ReadMemory class implements a structure for "m" packets. Upon receiving these packets, the server is
+     * The ReadMemory class implements a structure for "m" and "x" packets. Upon receiving these packets, the server is
      * expected to read memory from the target and send it the client.
+     *
+     * The two packets share the same "addr,length" syntax. They only differ in the encoding of the response - "m"
+     * packets are answered with hex-encoded data, whereas "x" packets are answered with raw (escaped) binary data,
+     * prefixed with a 'b' character.
      */
     class ReadMemory: public Gdb::CommandPackets::CommandPacket
     {
@@ -32,6 +36,12 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
          */
         Targets::TargetMemorySize bytes = 0;
 
+        /**
+         * Whether the memory should be sent to GDB in binary form ("x" packet), as opposed to hex-encoded form
+         * ("m" packet).
+         */
+        bool binary = false;
+
         explicit ReadMemory(const RawPacket& rawPacket, const Gdb::TargetDescriptor& gdbTargetDescriptor);
 
         void handle(
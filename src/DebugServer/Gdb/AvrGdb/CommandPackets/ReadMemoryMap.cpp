@@ -1,5 +1,7 @@
 #include "ReadMemoryMap.hpp"
 
+#include <QString>
+
 #include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
 
 #include "src/Exceptions/Exception.hpp"
@@ -95,9 +95,11 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
             registers.insert(registers.end(), static_cast<unsigned char>(programCounter >> 16));
             registers.insert(registers.end(), static_cast<unsigned char>(programCounter >> 24));
 
-            debugSession.connection.writePacket(
-                ResponsePacket(Services::StringService::toHex(registers))
-            );
+            auto responseData = std::vector<unsigned char>();
+            responseData.reserve(registers.size() * 2);
+            Services::StringService::appendHex(registers, responseData);
+
+            debugSession.connection.writePacket(ResponsePacket(std::move(responseData)));
 
         } catch (const Exception& exception) {
             Logger::error("Failed to read registers - " + exception.getMessage());
@@ -18,6 +18,7 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
         Logger::info("Handling VContContinueExecution packet");
 
         try {
+            debugSession.applyBreakpointChanges(targetControllerService);
             targetControllerService.continueTargetExecution(std::nullopt, std::nullopt);
             debugSession.waitingForBreak = true;
 
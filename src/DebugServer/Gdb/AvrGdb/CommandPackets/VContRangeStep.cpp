@@ -18,8 +18,14 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
 
     using ::Exceptions::Exception;
 
-    VContRangeStep::VContRangeStep(const RawPacket& rawPacket)
+    VContRangeStep::VContRangeStep(
+        const RawPacket& rawPacket,
+        RangeSteppingAnalysisCache& analysisCache,
+        const Services::Avr8ProgramAnalysisService& programAnalysisService
+    )
         : CommandPacket(rawPacket)
+        , analysisCache(analysisCache)
+        , programAnalysisService(programAnalysisService)
     {
         if (this->data.size() < 10) {
             throw Exception("Unexpected VContRangeStep packet size");
@@ -50,7 +56,6 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
     }
 
     void VContRangeStep::handle(Gdb::DebugSession& debugSession, TargetControllerService& targetControllerService) {
-        using Services::Avr8InstructionService;
         using Services::StringService;
 
         Logger::info("Handling VContRangeStep packet");
@@ -78,114 +83,40 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
                 Logger::warning(
                     "Attempted to start new range stepping session with one already active - terminating active session"
                 );
-                debugSession.terminateRangeSteppingSession(targetControllerService);
+                debugSession.terminateRangeSteppingSession();
             }
 
             if (this->startAddress == this->endAddress || (this->endAddress - this->startAddress) <= 2) {
                 // Single step requested. No need for a range step here.
+                debugSession.applyBreakpointChanges(targetControllerService);
                 targetControllerService.stepTargetExecution(std::nullopt);
                 debugSession.waitingForBreak = true;
                 return;
             }
 
             const auto addressRange = Targets::TargetMemoryAddressRange(this->startAddress, this->endAddress);
-            auto rangeSteppingSession = RangeSteppingSession(addressRange, {});
-
-            const auto instructionsByAddress = Avr8InstructionService::fetchInstructions(
-                addressRange,
-                targetDescriptor,
-                targetControllerService
-            );
-
-            Logger::debug(
-                "Inspecting " + std::to_string(instructionsByAddress.size()) + " instructions within stepping range "
-                "(byte addresses) 0x" + StringService::toHex(addressRange.startAddress) + " -> 0x"
-                    + StringService::toHex(addressRange.endAddress) + ", in preparation for new range stepping session"
-            );
-
-            for (const auto& [instructionAddress, instruction] : instructionsByAddress) {
-                if (!instruction.has_value()) {
-                    /*
-                     * We weren't able to decode the opcode at this address. We have no idea what this instruction
-                     * will do.
-                     */
-                    Logger::error(
-                        "Failed to decode AVR8 opcode at byte address 0x" + StringService::toHex(instructionAddress)
-                            + " - the instruction will have to be intercepted. Please enable debug logging, reproduce "
-                            "this message and report as an issue via " + Services::PathService::homeDomainName()
-                            + "/report-issue"
-                    );
-
-                    /*
-                     * We have no choice but to intercept it. When we reach it, we'll perform a single step and see
-                     * what happens.
-                     */
-                    rangeSteppingSession.interceptedAddresses.insert(instructionAddress);
-                    continue;
-                }
+            auto interceptedAddresses = this->analysisCache.get(addressRange);
 
-                if (instruction->canChangeProgramFlow) {
-                    const auto destinationAddress = Avr8InstructionService::resolveProgramDestinationAddress(
-                        *instruction,
-                        instructionAddress,
-                        instructionsByAddress
-                    );
+            if (interceptedAddresses.has_value()) {
+                Logger::debug(
+                    "Using cached analysis for stepping range (byte addresses) 0x"
+                        + StringService::toHex(addressRange.startAddress) + " -> 0x"
+                        + StringService::toHex(addressRange.endAddress)
+                );
 
-                    if (!destinationAddress.has_value()) {
-                        /*
-                         * We don't know where this instruction may jump to, so we'll have to intercept it and perform
-                         * a single step when we reach it.
-                         */
-                        Logger::debug(
-                            "Intercepting CCPF instruction (\"" + instruction->name + "\") at byte address 0x"
-                                + StringService::toHex(instructionAddress)
-                        );
-                        rangeSteppingSession.interceptedAddresses.insert(instructionAddress);
-                        continue;
-                    }
-
-                    if (
-                        *destinationAddress < programMemoryAddressRange.startAddress
-                        || *destinationAddress > programMemoryAddressRange.endAddress
-                    ) {
-                        /*
-                         * This instruction may jump to an invalid address. Someone screwed up here - could be
-                         * something wrong in Bloom (opcode decoding bug, incorrect program memory address range in
-                         * the target descriptor, etc.), or the user has an invalid instruction in their program code.
-                         *
-                         * We have no choice but to intercept the instruction. When we reach it, we'll perform a single
-                         * step and see what happens.
-                         */
-                        Logger::debug(
-                            "Intercepting CCPF instruction (\"" + instruction->name + "\") with invalid destination "
-                            "byte address (0x" + StringService::toHex(*destinationAddress) + "), at byte address 0x"
-                                + StringService::toHex(instructionAddress)
-                        );
-                        rangeSteppingSession.interceptedAddresses.insert(instructionAddress);
-                        continue;
-                    }
-
-                    if (
-                        *destinationAddress < addressRange.startAddress
-                        || *destinationAddress >= addressRange.endAddress
-                    ) {
-                        /*
-                         * This instruction may jump to an address outside the requested stepping range.
-                         *
-                         * Because we know exactly where it will jump to (if it jumps), we only need to intercept the
-                         * destination address.
-                         */
-                        Logger::debug(
-                            "Intercepting destination byte address 0x" + StringService::toHex(*destinationAddress)
-                                + " of CCPF instruction (\"" + instruction->name + "\") at byte address 0x"
-                                + StringService::toHex(instructionAddress)
-                        );
-                        rangeSteppingSession.interceptedAddresses.insert(*destinationAddress);
-                    }
-                }
+            } else {
+                interceptedAddresses = this->resolveInterceptedAddresses(
+                    addressRange,
+                    debugSession.gdbTargetDescriptor.targetDescriptor,
+                    targetControllerService
+                );
+                this->analysisCache.insert(addressRange, *interceptedAddresses);
             }
 
-            debugSession.startRangeSteppingSession(std::move(rangeSteppingSession), targetControllerService);
+            auto rangeSteppingSession = RangeSteppingSession(addressRange, *interceptedAddresses);
+
+            debugSession.startRangeSteppingSession(std::move(rangeSteppingSession));
+            debugSession.applyBreakpointChanges(targetControllerService);
 
             /*
              * GDB expects us to start the range stepping session with a single step, and then only continue if the
@@ -203,4 +134,153 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
             debugSession.connection.writePacket(ErrorResponsePacket());
         }
     }
+
+    std::set<Targets::TargetMemoryAddress> VContRangeStep::resolveInterceptedAddresses(
+        const Targets::TargetMemoryAddressRange& addressRange,
+        const Targets::TargetDescriptor& targetDescriptor,
+        TargetControllerService& targetControllerService
+    ) {
+        using Services::Avr8InstructionService;
+        using Services::StringService;
+        using Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::Decoder;
+        using Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::CompactInstruction;
+        using Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::InstructionStream;
+
+        const auto& programMemoryAddressRange = targetDescriptor.memoryDescriptorsByType.at(
+            targetDescriptor.programMemoryType
+        ).addressRange;
+
+        auto interceptedAddresses = std::set<Targets::TargetMemoryAddress>();
+
+        /*
+         * If we have a program analysis for the current program memory, and it covers the stepping range, we can use
+         * its instructions instead of fetching them from the target.
+         */
+        const auto programAnalysis = this->programAnalysisService.currentAnalysis();
+        auto fetchedInstructions = std::optional<InstructionStream>();
+
+        const auto& instructions = (
+            programAnalysis != nullptr
+            && addressRange.startAddress >= programAnalysis->instructions.startByteAddress
+            && addressRange.endAddress <= programAnalysis->instructions.endByteAddress()
+        )
+            ? programAnalysis->instructions
+            : fetchedInstructions.emplace(Avr8InstructionService::fetchInstructionStream(
+                addressRange,
+                targetDescriptor,
+                targetControllerService
+            ));
+
+        const auto firstRecordIndex = (addressRange.startAddress - instructions.startByteAddress) / 2;
+        const auto endRecordIndex = (addressRange.endAddress - instructions.startByteAddress) / 2;
+
+        Logger::debug(
+            "Inspecting " + std::to_string(endRecordIndex - firstRecordIndex) + " program words within stepping range "
+            "(byte addresses) 0x" + StringService::toHex(addressRange.startAddress) + " -> 0x"
+                + StringService::toHex(addressRange.endAddress) + ", in preparation for new range stepping session"
+        );
+
+        // Instruction names are only needed for logging, so we only reconstruct the full instruction when we need them
+        const auto instructionName = [] (const CompactInstruction& instruction) {
+            return Decoder::instruction(instruction)->name;
+        };
+
+        auto recordIndex = std::size_t{firstRecordIndex};
+        while (recordIndex < endRecordIndex) {
+            const auto& instruction = instructions.records[recordIndex];
+            const auto instructionAddress = static_cast<Targets::TargetMemoryAddress>(
+                instructions.startByteAddress + (recordIndex * 2)
+            );
+
+            if (instruction.isContinuation()) {
+                // The stepping range begins within a 32-bit instruction
+                ++recordIndex;
+                continue;
+            }
+
+            recordIndex += instruction.byteSize / 2;
+
+            if (!instruction.decoded()) {
+                /*
+                 * We weren't able to decode the opcode at this address. We have no idea what this instruction
+                 * will do.
+                 */
+                Logger::error(
+                    "Failed to decode AVR8 opcode at byte address 0x" + StringService::toHex(instructionAddress)
+                        + " - the instruction will have to be intercepted. Please enable debug logging, reproduce "
+                        "this message and report as an issue via " + Services::PathService::homeDomainName()
+                        + "/report-issue"
+                );
+
+                /*
+                 * We have no choice but to intercept it. When we reach it, we'll perform a single step and see
+                 * what happens.
+                 */
+                interceptedAddresses.insert(instructionAddress);
+                continue;
+            }
+
+            if (instruction.canChangeProgramFlow()) {
+                const auto destinationAddress = Avr8InstructionService::resolveProgramDestinationAddress(
+                    instruction,
+                    instructionAddress,
+                    instructions
+                );
+
+                if (!destinationAddress.has_value()) {
+                    /*
+                     * We don't know where this instruction may jump to, so we'll have to intercept it and perform
+                     * a single step when we reach it.
+                     */
+                    Logger::debug(
+                        "Intercepting CCPF instruction (\"" + instructionName(instruction) + "\") at byte address 0x"
+                            + StringService::toHex(instructionAddress)
+                    );
+                    interceptedAddresses.insert(instructionAddress);
+                    continue;
+                }
+
+                if (
+                    *destinationAddress < programMemoryAddressRange.startAddress
+                    || *destinationAddress > programMemoryAddressRange.endAddress
+                ) {
+                    /*
+                     * This instruction may jump to an invalid address. Someone screwed up here - could be
+                     * something wrong in Bloom (opcode decoding bug, incorrect program memory address range in
+                     * the target descriptor, etc.), or the user has an invalid instruction in their program code.
+                     *
+                     * We have no choice but to intercept the instruction. When we reach it, we'll perform a single
+                     * step and see what happens.
+                     */
+                    Logger::debug(
+                        "Intercepting CCPF instruction (\"" + instructionName(instruction) + "\") with invalid "
+                        "destination byte address (0x" + StringService::toHex(*destinationAddress)
+                            + "), at byte address 0x" + StringService::toHex(instructionAddress)
+                    );
+                    interceptedAddresses.insert(instructionAddress);
+                    continue;
+                }
+
+                if (
+                    *destinationAddress < addressRange.startAddress
+                    || *destinationAddress >= addressRange.endAddress
+                ) {
+                    /*
+                     * This instruction may jump to an address outside the requested stepping range.
+                     *
+                     * Because we know exactly where it will jump to (if it jumps), we only need to intercept the
+                     * destination address.
+                     */
+                    Logger::debug(
+                        "Intercepting destination byte address 0x" + StringService::toHex(*destinationAddress)
+                            + " of CCPF instruction (\"" + instructionName(instruction) + "\") at byte address 0x"
+                            + StringService::toHex(instructionAddress)
+                    );
+                    interceptedAddresses.insert(*destinationAddress);
+                }
+            }
+        }
+
+        return interceptedAddresses;
+    }
 }
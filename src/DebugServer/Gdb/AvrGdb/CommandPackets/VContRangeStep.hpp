@@ -1,10 +1,16 @@
 #pragma once
 
 #include <cstdint>
+#include <set>
 
 #include "src/DebugServer/Gdb/CommandPackets/CommandPacket.hpp"
 
+#include "src/DebugServer/Gdb/AvrGdb/RangeSteppingAnalysisCache.hpp"
+
+#include "src/Services/Avr8ProgramAnalysisService.hpp"
+
 #include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetDescriptor.hpp"
 
 namespace DebugServer::Gdb::AvrGdb::CommandPackets
 {
@@ -19,11 +25,38 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
         Targets::TargetMemoryAddress startAddress;
         Targets::TargetMemoryAddress endAddress;
 
-        explicit VContRangeStep(const RawPacket& rawPacket);
+        explicit VContRangeStep(
+            const RawPacket& rawPacket,
+            RangeSteppingAnalysisCache& analysisCache,
+            const Services::Avr8ProgramAnalysisService& programAnalysisService
+        );
 
         void handle(
             Gdb::DebugSession& debugSession,
             Services::TargetControllerService& targetControllerService
         ) override;
+
+    private:
+        RangeSteppingAnalysisCache& analysisCache;
+        const Services::Avr8ProgramAnalysisService& programAnalysisService;
+
+        /**
+         * Fetches and decodes the instructions within the given stepping range (unless we have a current program
+         * analysis that covers the range - see AnalyseProgram), and determines which program memory addresses must be
+         * intercepted in order to catch the target leaving the range.
+         *
+         * @param addressRange
+         *  The stepping range. addressRange.endAddress is exclusive.
+         *
+         * @param targetDescriptor
+         * @param targetControllerService
+         *
+         * @return
+         */
+        std::set<Targets::TargetMemoryAddress> resolveInterceptedAddresses(
+            const Targets::TargetMemoryAddressRange& addressRange,
+            const Targets::TargetDescriptor& targetDescriptor,
+            Services::TargetControllerService& targetControllerService
+        );
     };
 }
@@ -18,6 +18,7 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
         Logger::info("Handling VContStepExecution packet");
 
         try {
+            debugSession.applyBreakpointChanges(targetControllerService);
             targetControllerService.stepTargetExecution(std::nullopt);
             debugSession.waitingForBreak = true;
 
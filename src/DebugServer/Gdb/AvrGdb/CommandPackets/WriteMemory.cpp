@@ -1,8 +1,12 @@
 #include "WriteMemory.hpp"
 
+#include <algorithm>
+#include <string_view>
+
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
 
+#include "src/Services/StringService.hpp"
 #include "src/Logger/Logger.hpp"
 #include "src/Exceptions/Exception.hpp"
 
@@ -22,46 +26,62 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
             throw Exception("Invalid packet length");
         }
 
-        const auto packetString = QString::fromLocal8Bit(
-            reinterpret_cast<const char*>(this->data.data() + 1),
-            static_cast<int>(this->data.size() - 1)
-        );
+        this->binary = this->data[0] == 'X';
 
         /*
-         * The write memory ('M') packet consists of three segments, an address, a length and a buffer.
+         * The write memory ('M' and 'X') packets consist of three segments, an address, a length and a buffer.
          * The address and length are separated by a comma character, and the buffer proceeds a colon character.
+         *
+         * In 'X' packets, the buffer holds raw binary data, which may contain comma and colon characters, so we
+         * only parse the address and length segments as text.
          */
-        const auto packetSegments = packetString.split(",");
-        if (packetSegments.size() != 2) {
-            throw Exception(
-                "Unexpected number of segments in packet data: " + std::to_string(packetSegments.size())
-            );
+        const auto bufferDelimiterIt = std::find(this->data.begin() + 1, this->data.end(), ':');
+        if (bufferDelimiterIt == this->data.end()) {
+            throw Exception("Missing buffer delimiter in write memory packet data");
         }
 
-        bool conversionStatus = false;
-        const auto gdbStartAddress = packetSegments.at(0).toUInt(&conversionStatus, 16);
+        const auto packetData = std::string_view(
+            reinterpret_cast<const char*>(this->data.data() + 1),
+            static_cast<std::size_t>(std::distance(this->data.begin() + 1, bufferDelimiterIt))
+        );
 
-        if (!conversionStatus) {
-            throw Exception("Failed to parse start address from write memory packet data");
+        const auto delimiterPosition = packetData.find(',');
+        if (delimiterPosition == std::string_view::npos) {
+            throw Exception("Missing delimiter in write memory packet data");
         }
 
-        this->memoryType = gdbTargetDescriptor.getMemoryTypeFromGdbAddress(gdbStartAddress);
-        this->startAddress = gdbStartAddress & ~(gdbTargetDescriptor.getMemoryOffset(this->memoryType));
+        auto gdbStartAddress = Targets::TargetMemoryAddress{0};
+        auto bufferSize = Targets::TargetMemorySize{0};
 
-        const auto lengthAndBufferSegments = packetSegments.at(1).split(":");
-        if (lengthAndBufferSegments.size() != 2) {
-            throw Exception(
-                "Unexpected number of segments in packet data: "
-                    + std::to_string(lengthAndBufferSegments.size())
-            );
+        try {
+            gdbStartAddress = Services::StringService::uint32FromHex(packetData.substr(0, delimiterPosition));
+
+        } catch (const Exception& exception) {
+            throw Exception("Failed to parse start address from write memory packet data - " + exception.getMessage());
         }
 
-        const auto bufferSize = lengthAndBufferSegments.at(0).toUInt(&conversionStatus, 16);
-        if (!conversionStatus) {
-            throw Exception("Failed to parse write length from write memory packet data");
+        try {
+            bufferSize = Services::StringService::uint32FromHex(packetData.substr(delimiterPosition + 1));
+
+        } catch (const Exception& exception) {
+            throw Exception("Failed to parse write length from write memory packet data - " + exception.getMessage());
         }
 
-        this->buffer = Packet::hexToData(lengthAndBufferSegments.at(1).toStdString());
+        this->memoryType = gdbTargetDescriptor.getMemoryTypeFromGdbAddress(gdbStartAddress);
+        this->startAddress = gdbStartAddress & ~(gdbTargetDescriptor.getMemoryOffset(this->memoryType));
+
+        const auto bufferOffset = static_cast<std::size_t>(std::distance(this->data.begin(), bufferDelimiterIt)) + 1;
+
+        if (this->binary) {
+            // The Connection class will have already unescaped the binary data
+            this->buffer = Targets::TargetMemoryBuffer(this->data.begin() + bufferOffset, this->data.end());
+
+        } else {
+            this->buffer = Services::StringService::dataFromHex(std::string_view(
+                reinterpret_cast<const char*>(this->data.data() + bufferOffset),
+                this->data.size() - bufferOffset
+            ));
+        }
 
         if (this->buffer.size() != bufferSize) {
             throw Exception("Buffer size does not match length value given in write memory packet");
@@ -72,6 +92,15 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
         Logger::info("Handling WriteMemory packet");
 
         try {
+            if (this->buffer.size() == 0) {
+                /*
+                 * GDB probes for "X" packet support by sending an empty write - we respond with OK regardless of the
+                 * memory type, so this must come before the memory type check.
+                 */
+                debugSession.connection.writePacket(OkResponsePacket());
+                return;
+            }
+
             const auto& memoryDescriptorsByType = debugSession.gdbTargetDescriptor.targetDescriptor.memoryDescriptorsByType;
             const auto memoryDescriptorIt = memoryDescriptorsByType.find(this->memoryType);
 
@@ -89,16 +118,11 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
                  * so just respond with an error and request that this issue be reported.
                  */
                 throw Exception(
-                    "GDB attempted to write to program memory via an \"M\" packet - this is not supported. Please "
-                    "report this issue to Bloom developers with the full debug log."
+                    "GDB attempted to write to program memory via an \"M\" or \"X\" packet - this is not supported. "
+                    "Please report this issue to Bloom developers with the full debug log."
                 );
             }
 
-            if (this->buffer.size() == 0) {
-                debugSession.connection.writePacket(OkResponsePacket());
-                return;
-            }
-
             const auto& memoryDescriptor = memoryDescriptorIt->second;
 
             if (this->memoryType == Targets::TargetMemoryType::EEPROM) {
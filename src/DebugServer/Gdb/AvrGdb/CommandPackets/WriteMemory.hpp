@@ -11,8 +11,10 @@
 namespace DebugServer::Gdb::AvrGdb::CommandPackets
 {
     /**
-     * The WriteMemory class implements the structure for "M" packets. Upon receiving this packet, the server is
-     * expected to write data to the target's memory, at the specified start address.
+     * The WriteMemory class implements the structure for "M" and "X" packets. Upon receiving these packets, the
+     * server is expected to write data to the target's memory, at the specified start address.
+     *
+     * The "M" packet carries hex-encoded data, whereas the "X" packet carries raw (escaped) binary data.
      */
     class WriteMemory: public Gdb::CommandPackets::CommandPacket
     {
@@ -32,6 +34,11 @@ namespace DebugServer::Gdb::AvrGdb::CommandPackets
          */
         Targets::TargetMemoryBuffer buffer;
 
+        /**
+         * Whether the data was received in binary form ("X" packet), as opposed to hex-encoded form ("M" packet).
+         */
+        bool binary = false;
+
         explicit WriteMemory(const RawPacket& rawPacket, const Gdb::TargetDescriptor& gdbTargetDescriptor);
 
         void handle(
@@ -1,5 +1,7 @@
 #include "WriteRegister.hpp"
 
+#include <QString>
+
 #include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
 #include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
 
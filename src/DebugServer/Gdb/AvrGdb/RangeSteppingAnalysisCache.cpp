@@ -0,0 +1,71 @@
+#include "RangeSteppingAnalysisCache.hpp"
+
+#include <algorithm>
+
+#include "src/Logger/Logger.hpp"
+
+namespace DebugServer::Gdb::AvrGdb
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+
+    std::optional<std::set<TargetMemoryAddress>> RangeSteppingAnalysisCache::get(
+        const Targets::TargetMemoryAddressRange& range
+    ) const {
+        const auto entryIt = this->entriesByRange.find({range.startAddress, range.endAddress});
+
+        if (entryIt == this->entriesByRange.end()) {
+            return std::nullopt;
+        }
+
+        return entryIt->second.interceptedAddresses;
+    }
+
+    void RangeSteppingAnalysisCache::insert(
+        const Targets::TargetMemoryAddressRange& range,
+        const std::set<TargetMemoryAddress>& interceptedAddresses
+    ) {
+        const auto key = std::pair(range.startAddress, range.endAddress);
+
+        if (
+            this->entriesByRange.size() >= RangeSteppingAnalysisCache::MAX_ENTRIES
+            && !this->entriesByRange.contains(key)
+        ) {
+            const auto oldestEntryIt = std::min_element(
+                this->entriesByRange.begin(),
+                this->entriesByRange.end(),
+                [] (const auto& entryA, const auto& entryB) {
+                    return entryA.second.insertionNumber < entryB.second.insertionNumber;
+                }
+            );
+
+            this->entriesByRange.erase(oldestEntryIt);
+        }
+
+        this->entriesByRange[key] = Entry{
+            .interceptedAddresses = interceptedAddresses,
+            .insertionNumber = this->nextInsertionNumber++,
+        };
+    }
+
+    void RangeSteppingAnalysisCache::invalidate(TargetMemoryAddress startAddress, TargetMemorySize size) {
+        if (size == 0) {
+            return;
+        }
+
+        const auto endAddress = startAddress + size; // Exclusive
+
+        std::erase_if(this->entriesByRange, [startAddress, endAddress] (const auto& entry) {
+            const auto& [rangeStartAddress, rangeEndAddress] = entry.first;
+            return rangeStartAddress < endAddress && startAddress < rangeEndAddress;
+        });
+    }
+
+    void RangeSteppingAnalysisCache::clear() {
+        if (!this->entriesByRange.empty()) {
+            Logger::debug("Clearing range stepping analysis cache");
+        }
+
+        this->entriesByRange.clear();
+    }
+}
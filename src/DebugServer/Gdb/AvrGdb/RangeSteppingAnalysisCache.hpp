@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <utility>
+#include <optional>
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace DebugServer::Gdb::AvrGdb
+{
+    /**
+     * Before starting a range stepping session, we fetch and decode every instruction in the stepping range, to
+     * determine which program memory addresses must be intercepted (see VContRangeStep::handle()). GDB will often
+     * request the same stepping ranges repeatedly (for example, when stepping over each line in a loop body), so we
+     * keep the results of that analysis here, mapped by the stepping range.
+     *
+     * The results only depend on the content of the program memory within the stepping range. Entries are invalidated
+     * when any part of that program memory is written to, and the whole cache is cleared when the target enters
+     * programming mode (where the program memory may be erased). See AvrGdbRsp::onTargetMemoryWritten() and
+     * AvrGdbRsp::onProgrammingModeEnabled().
+     *
+     * This cache outlives debug sessions - it's held by the AvrGdbRsp object. To keep its size bounded, it holds no
+     * more than RangeSteppingAnalysisCache::MAX_ENTRIES entries. When full, the oldest entry is discarded.
+     */
+    class RangeSteppingAnalysisCache
+    {
+    public:
+        static constexpr auto MAX_ENTRIES = std::size_t{256};
+
+        /**
+         * Returns the cached intercepted addresses for the given stepping range, if we have them.
+         *
+         * @param range
+         *  The stepping range. range.endAddress is exclusive.
+         *
+         * @return
+         */
+        std::optional<std::set<Targets::TargetMemoryAddress>> get(const Targets::TargetMemoryAddressRange& range) const;
+
+        /**
+         * Stores the intercepted addresses for the given stepping range.
+         *
+         * @param range
+         *  The stepping range. range.endAddress is exclusive.
+         *
+         * @param interceptedAddresses
+         */
+        void insert(
+            const Targets::TargetMemoryAddressRange& range,
+            const std::set<Targets::TargetMemoryAddress>& interceptedAddresses
+        );
+
+        /**
+         * Discards all entries for stepping ranges that intersect with the given program memory range.
+         *
+         * @param startAddress
+         * @param size
+         */
+        void invalidate(Targets::TargetMemoryAddress startAddress, Targets::TargetMemorySize size);
+
+        /**
+         * Discards all entries.
+         */
+        void clear();
+
+    private:
+        struct Entry
+        {
+            std::set<Targets::TargetMemoryAddress> interceptedAddresses;
+
+            /**
+             * Used to find the oldest entry, when the cache is full.
+             */
+            std::uint64_t insertionNumber = 0;
+        };
+
+        /**
+         * Entries, mapped by the stepping range (start address and exclusive end address).
+         */
+        std::map<std::pair<Targets::TargetMemoryAddress, Targets::TargetMemoryAddress>, Entry> entriesByRange;
+
+        std::uint64_t nextInsertionNumber = 0;
+    };
+}
@@ -0,0 +1,75 @@
+#include "CacheInfo.hpp"
+
+#include <string>
+
+#include "src/DebugServer/Gdb/ResponsePackets/ErrorResponsePacket.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+
+#include "src/Services/StringService.hpp"
+#include "src/Logger/Logger.hpp"
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::ErrorResponsePacket;
+    using ResponsePackets::ResponsePacket;
+
+    using ::Exceptions::Exception;
+
+    CacheInfo::CacheInfo(Monitor&& monitorPacket)
+        : Monitor(std::move(monitorPacket))
+    {}
+
+    void CacheInfo::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling CacheInfo packet");
+
+        try {
+            const auto cacheStatistics = targetControllerService.getCacheStatistics();
+
+            const auto formatStatistics = [] (
+                const std::string& cacheName,
+                const TargetController::CacheStatistics& statistics
+            ) {
+                return "  " + cacheName + std::string(cacheName.size() < 16 ? 16 - cacheName.size() : 1, ' ')
+                    + "hits: " + std::to_string(statistics.hits)
+                    + ", misses: " + std::to_string(statistics.misses)
+                    + ", bytes saved: " + std::to_string(statistics.bytesSaved) + "\n";
+            };
+
+            auto output = std::string("Cache statistics:\n\n");
+            output += formatStatistics("Program memory", cacheStatistics.programMemoryCacheStatistics);
+
+            for (const auto& [memoryType, statistics] : cacheStatistics.memoryCacheStatisticsByType) {
+                switch (memoryType) {
+                    case Targets::TargetMemoryType::RAM: {
+                        output += formatStatistics("RAM", statistics);
+                        break;
+                    }
+                    case Targets::TargetMemoryType::EEPROM: {
+                        output += formatStatistics("EEPROM", statistics);
+                        break;
+                    }
+                    case Targets::TargetMemoryType::FUSES: {
+                        output += formatStatistics("Fuses", statistics);
+                        break;
+                    }
+                    default: {
+                        output += formatStatistics("Other", statistics);
+                        break;
+                    }
+                }
+            }
+
+            output += formatStatistics("Registers", cacheStatistics.registerCacheStatistics);
+
+            debugSession.connection.writePacket(ResponsePacket(Services::StringService::toHex(output)));
+
+        } catch (const Exception& exception) {
+            Logger::error("Failed to obtain cache statistics - " + exception.getMessage());
+            debugSession.connection.writePacket(ErrorResponsePacket());
+        }
+    }
+}
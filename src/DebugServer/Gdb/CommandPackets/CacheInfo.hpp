@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Monitor.hpp"
+
+namespace DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The CacheInfo class implements a structure for the "monitor cache" GDB command.
+     *
+     * We output the hit/miss statistics of the TargetController's memory and register caches.
+     */
+    class CacheInfo: public Monitor
+    {
+    public:
+        explicit CacheInfo(Monitor&& monitorPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
@@ -26,6 +26,7 @@ namespace DebugServer::Gdb::CommandPackets
         Logger::info("Handling ContinueExecution packet");
 
         try {
+            debugSession.applyBreakpointChanges(targetControllerService);
             targetControllerService.continueTargetExecution(this->fromAddress, std::nullopt);
             debugSession.waitingForBreak = true;
 
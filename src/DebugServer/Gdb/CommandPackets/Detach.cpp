@@ -24,6 +24,12 @@ namespace DebugServer::Gdb::CommandPackets
         Logger::info("Handling Detach packet");
 
         try {
+            /*
+             * GDB removes its breakpoints before detaching. We only apply breakpoint changes upon resuming the target,
+             * so we must apply them here, otherwise they'll remain on the target after GDB has gone.
+             */
+            debugSession.applyBreakpointChanges(targetControllerService);
+
             if (Services::ProcessService::isManagedByClion()) {
                 targetControllerService.shutdown();
             }
@@ -31,7 +37,7 @@ namespace DebugServer::Gdb::CommandPackets
             debugSession.connection.writePacket(OkResponsePacket());
 
         } catch (const Exception& exception) {
-            Logger::error("Failed to shut down TargetController - " + exception.getMessage());
+            Logger::error("Failed to detach - " + exception.getMessage());
             debugSession.connection.writePacket(ErrorResponsePacket());
         }
     }
@@ -28,7 +28,7 @@ namespace DebugServer::Gdb::CommandPackets
             targetControllerService.stopTargetExecution();
 
             if (debugSession.activeRangeSteppingSession.has_value()) {
-                debugSession.terminateRangeSteppingSession(targetControllerService);
+                debugSession.terminateRangeSteppingSession();
             }
 
             debugSession.waitingForBreak = false;
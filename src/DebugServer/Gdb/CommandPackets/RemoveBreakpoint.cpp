@@ -56,7 +56,7 @@ namespace DebugServer::Gdb::CommandPackets
         try {
             Logger::debug("Removing breakpoint at address " + std::to_string(this->address));
 
-            debugSession.removeExternalBreakpoint(this->address, targetControllerService);
+            debugSession.removeExternalBreakpoint(this->address);
             debugSession.connection.writePacket(OkResponsePacket());
 
         } catch (const Exception& exception) {
@@ -0,0 +1,27 @@
+#include "StartNoAckMode.hpp"
+
+#include "src/DebugServer/Gdb/ResponsePackets/OkResponsePacket.hpp"
+
+#include "src/Logger/Logger.hpp"
+
+namespace DebugServer::Gdb::CommandPackets
+{
+    using Services::TargetControllerService;
+
+    using ResponsePackets::OkResponsePacket;
+
+    StartNoAckMode::StartNoAckMode(const RawPacket& rawPacket)
+        : CommandPacket(rawPacket)
+    {}
+
+    void StartNoAckMode::handle(DebugSession& debugSession, TargetControllerService& targetControllerService) {
+        Logger::info("Handling StartNoAckMode packet");
+
+        /*
+         * The OK response must still be acknowledged by the client. Acknowledgements cease once the client has
+         * received it.
+         */
+        debugSession.connection.writePacket(OkResponsePacket());
+        debugSession.connection.disableAcknowledgements();
+    }
+}
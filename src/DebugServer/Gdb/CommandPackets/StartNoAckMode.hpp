@@ -0,0 +1,22 @@
+#pragma once
+
+#include "CommandPacket.hpp"
+
+namespace DebugServer::Gdb::CommandPackets
+{
+    /**
+     * The StartNoAckMode class implements a structure for the "QStartNoAckMode" packet. Upon receiving this packet,
+     * we respond with an OK packet and then stop acknowledging packets (and stop expecting acknowledgements from
+     * the client).
+     */
+    class StartNoAckMode: public CommandPacket
+    {
+    public:
+        explicit StartNoAckMode(const RawPacket& rawPacket);
+
+        void handle(
+            DebugSession& debugSession,
+            Services::TargetControllerService& targetControllerService
+        ) override;
+    };
+}
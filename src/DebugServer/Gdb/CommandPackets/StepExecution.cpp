@@ -27,6 +27,7 @@ namespace DebugServer::Gdb::CommandPackets
         Logger::info("Handling StepExecution packet");
 
         try {
+            debugSession.applyBreakpointChanges(targetControllerService);
             targetControllerService.stepTargetExecution(this->fromAddress);
             debugSession.waitingForBreak = true;
 
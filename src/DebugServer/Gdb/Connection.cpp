@@ -1,6 +1,7 @@
 #include "Connection.hpp"
 
 #include <arpa/inet.h>
+#include <netinet/tcp.h>
 #include <unistd.h>
 #include <cerrno>
 #include <fcntl.h>
@@ -27,6 +28,24 @@ namespace DebugServer::Gdb
     {
         this->accept(serverSocketFileDescriptor);
 
+        /*
+         * With acknowledgements enabled, we write the acknowledgement of each packet separately from the response.
+         * Nagle's algorithm would hold the response back until the client's TCP ACK of the acknowledgement arrives,
+         * which can be delayed by up to 40ms.
+         */
+        const auto enableNoDelaySocketOption = 1;
+
+        if (::setsockopt(
+                this->socketFileDescriptor.value(),
+                IPPROTO_TCP,
+                TCP_NODELAY,
+                &(enableNoDelaySocketOption),
+                sizeof(enableNoDelaySocketOption)
+            ) < 0
+        ) {
+            Logger::warning("Failed to set socket TCP_NODELAY option.");
+        }
+
         ::fcntl(
             this->socketFileDescriptor.value(),
             F_SETFL,
@@ -54,98 +73,133 @@ namespace DebugServer::Gdb
         return std::string(ipAddress.data());
     }
 
-    std::vector<RawPacket> Connection::readRawPackets() {
-        std::vector<RawPacket> output;
+    RawPacket Connection::readRawPacket() {
+        while (this->pendingPackets.empty()) {
+            if (this->receiveBuffer.empty()) {
+                this->receiveBuffer.resize(Connection::RECEIVE_BUFFER_SIZE);
+            }
 
-        do {
-            const auto bytes = this->read();
-
-            std::size_t bufferSize = bytes.size();
-            for (std::size_t byteIndex = 0; byteIndex < bufferSize; byteIndex++) {
-                auto byte = bytes[byteIndex];
-
-                if (byte == 0x03) {
-                    /*
-                     * This is an interrupt packet - it doesn't carry any of the usual packet frame bytes, so we'll
-                     * just add them here, in order to keep things consistent.
-                     *
-                     * Because we're effectively faking the packet frame, we can use any value for the checksum.
-                     */
-                    output.push_back({'$', byte, '#', 'F', 'F'});
-                    continue;
+            const auto bytesRead = this->readInto(this->receiveBuffer);
+            this->parseRawPackets(std::span(this->receiveBuffer).first(bytesRead));
+        }
+
+        auto rawPacket = std::move(this->pendingPackets.front());
+        this->pendingPackets.pop();
+
+        return rawPacket;
+    }
+
+    void Connection::parseRawPackets(std::span<const unsigned char> buffer) {
+        static constexpr auto FRAME_BYTES = std::array<unsigned char, 3>({'$', '#', '}'});
+
+        auto byteIt = buffer.begin();
+
+        while (byteIt != buffer.end()) {
+            switch (this->parserState) {
+                case PacketParserState::IDLE: {
+                    const auto byte = *(byteIt++);
+
+                    if (byte == 0x03) {
+                        /*
+                         * This is an interrupt packet - it doesn't carry any of the usual packet frame bytes, so we'll
+                         * just add them here, in order to keep things consistent.
+                         *
+                         * Because we're effectively faking the packet frame, we can use any value for the checksum.
+                         */
+                        this->pendingPackets.push({'$', byte, '#', 'F', 'F'});
+                        break;
+                    }
+
+                    if (byte == '$') {
+                        // Beginning of packet
+                        this->partialPacket.clear();
+                        this->partialPacket.push_back('$');
+                        this->parserState = PacketParserState::PACKET_DATA;
+                        break;
+                    }
+
+                    if (byte == '+' || byte == '-') {
+                        // Acknowledgement of a packet we've sent - see Connection::writePacket()
+                        this->pendingAcknowledgements.push(byte);
+                    }
+
+                    // Any other bytes are ignored
+                    break;
                 }
+                case PacketParserState::PACKET_DATA: {
+                    // Copy everything up to the next frame byte, in one go
+                    const auto frameByteIt = std::find_first_of(
+                        byteIt,
+                        buffer.end(),
+                        FRAME_BYTES.begin(),
+                        FRAME_BYTES.end()
+                    );
+
+                    this->partialPacket.insert(this->partialPacket.end(), byteIt, frameByteIt);
+                    byteIt = frameByteIt;
+
+                    if (this->partialPacket.size() > Connection::ABSOLUTE_MAXIMUM_PACKET_READ_SIZE) {
+                        throw ClientCommunicationError("GDB client sent a packet exceeding the maximum packet size");
+                    }
+
+                    if (byteIt == buffer.end()) {
+                        // The rest of the packet will arrive in a subsequent read
+                        break;
+                    }
+
+                    const auto byte = *(byteIt++);
 
-                if (byte == '$') {
-                    // Beginning of packet
-                    RawPacket rawPacket;
-                    rawPacket.push_back('$');
-
-                    auto packetIndex = byteIndex;
-                    bool validPacket = false;
-                    bool isByteEscaped = false;
-
-                    for (packetIndex++; packetIndex < bufferSize; packetIndex++) {
-                        byte = bytes[packetIndex];
-
-                        if (byte == '}' && !isByteEscaped) {
-                            isByteEscaped = true;
-                            continue;
-                        }
-
-                        if (!isByteEscaped) {
-                            if (byte == '$') {
-                                // Unexpected end of packet
-                                break;
-                            }
-
-                            if (byte == '#') {
-                                // End of packet data
-                                if ((bufferSize - 1) < (packetIndex + 2)) {
-                                    // There should be at least two more bytes in the buffer, for the checksum.
-                                    break;
-                                }
-
-                                rawPacket.push_back(byte);
-
-                                // Add the checksum bytes and break the loop
-                                rawPacket.push_back(bytes[++packetIndex]);
-                                rawPacket.push_back(bytes[++packetIndex]);
-                                validPacket = true;
-                                break;
-                            }
-
-                        } else {
-                            // Escaped bytes are XOR'd with a 0x20 mask.
-                            byte ^= 0x20;
-                            isByteEscaped = false;
-                        }
-
-                        rawPacket.push_back(byte);
+                    if (byte == '}') {
+                        this->parserState = PacketParserState::ESCAPED_BYTE;
+                        break;
                     }
 
-                    if (!validPacket) {
-                        Logger::warning("GDB client sent invalid packet data - ignoring");
-                        continue;
+                    if (byte == '#') {
+                        // End of packet data - the checksum follows
+                        this->partialPacket.push_back(byte);
+                        this->checksumBytesRead = 0;
+                        this->parserState = PacketParserState::CHECKSUM;
+                        break;
+                    }
+
+                    // Unexpected start of a new packet - discard the current one
+                    Logger::warning("GDB client sent invalid packet data - ignoring");
+                    this->partialPacket.clear();
+                    this->partialPacket.push_back('$');
+                    break;
+                }
+                case PacketParserState::ESCAPED_BYTE: {
+                    // Escaped bytes are XOR'd with a 0x20 mask.
+                    this->partialPacket.push_back(*(byteIt++) ^ 0x20);
+                    this->parserState = PacketParserState::PACKET_DATA;
+                    break;
+                }
+                case PacketParserState::CHECKSUM: {
+                    this->partialPacket.push_back(*(byteIt++));
+
+                    if (++(this->checksumBytesRead) < 2) {
+                        break;
                     }
 
                     Logger::debug(
                         "Read GDB packet: "
                             + Services::StringService::replaceUnprintable(
-                                std::string(rawPacket.begin(), rawPacket.end())
+                                std::string(this->partialPacket.begin(), this->partialPacket.end())
                             )
                     );
 
-                    // Acknowledge receipt
-                    this->write({'+'});
+                    if (this->acknowledgementsEnabled) {
+                        // Acknowledge receipt
+                        this->write({'+'});
+                    }
 
-                    output.emplace_back(std::move(rawPacket));
-                    byteIndex = packetIndex;
+                    this->pendingPackets.emplace(std::move(this->partialPacket));
+                    this->partialPacket = RawPacket();
+                    this->parserState = PacketParserState::IDLE;
+                    break;
                 }
             }
-
-        } while (output.empty());
-
-        return output;
+        }
     }
 
     void Connection::writePacket(const ResponsePacket& packet) {
@@ -155,6 +209,17 @@ namespace DebugServer::Gdb
 
         Logger::debug("Writing GDB packet: " + std::string(rawPacket.begin(), rawPacket.end()));
 
+        if (!this->acknowledgementsEnabled) {
+            this->write(rawPacket);
+            return;
+        }
+
+        /*
+         * Any acknowledgements received before we've written the packet cannot be for this packet (GDB sends one
+         * upon connecting, for example).
+         */
+        this->pendingAcknowledgements = {};
+
         do {
             if (attempts > 10) {
                 throw ClientCommunicationError(
@@ -164,7 +229,46 @@ namespace DebugServer::Gdb
 
             this->write(rawPacket);
             attempts++;
-        } while (this->readSingleByte(false).value_or(0) != '+');
+        } while (this->waitForAcknowledgement().value_or(0) != '+');
+    }
+
+    std::optional<unsigned char> Connection::waitForAcknowledgement() {
+        static constexpr auto TIMEOUT = std::chrono::milliseconds(300);
+        const auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+
+        /*
+         * The client may send other data (such as an interrupt, or its next packet) before, or along with, the
+         * acknowledgement. So we feed everything we read through the packet parser, which will queue any packets for
+         * Connection::readRawPacket().
+         */
+        while (this->pendingAcknowledgements.empty()) {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                return std::nullopt;
+            }
+
+            if (this->receiveBuffer.empty()) {
+                this->receiveBuffer.resize(Connection::RECEIVE_BUFFER_SIZE);
+            }
+
+            const auto bytesRead = this->readInto(
+                this->receiveBuffer,
+                false,
+                std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now)
+            );
+
+            if (bytesRead == 0) {
+                // Timed out
+                return std::nullopt;
+            }
+
+            this->parseRawPackets(std::span(this->receiveBuffer).first(bytesRead));
+        }
+
+        const auto acknowledgement = this->pendingAcknowledgements.front();
+        this->pendingAcknowledgements.pop();
+
+        return acknowledgement;
     }
 
     void Connection::accept(int serverSocketFileDescriptor) {
@@ -190,13 +294,11 @@ namespace DebugServer::Gdb
         }
     }
 
-    std::vector<unsigned char> Connection::read(
-        std::optional<std::size_t> bytes,
+    std::size_t Connection::readInto(
+        std::span<unsigned char> buffer,
         bool interruptible,
         std::optional<std::chrono::milliseconds> timeout
     ) {
-        auto output = std::vector<unsigned char>();
-
         if (this->readInterruptEnabled != interruptible) {
             if (interruptible) {
                 this->enableReadInterrupts();
@@ -213,7 +315,7 @@ namespace DebugServer::Gdb
 
         if (!eventFileDescriptor.has_value()) {
             // Timed out
-            return output;
+            return 0;
         }
 
         if (eventFileDescriptor.value() == this->interruptEventNotifier.getFileDescriptor()) {
@@ -222,13 +324,10 @@ namespace DebugServer::Gdb
             throw DebugServerInterrupted();
         }
 
-        const auto bytesToRead = bytes.value_or(Connection::ABSOLUTE_MAXIMUM_PACKET_READ_SIZE);
-        output.resize(bytesToRead, 0x00);
-
         const auto bytesRead = ::read(
             this->socketFileDescriptor.value(),
-            output.data(),
-            bytesToRead
+            buffer.data(),
+            buffer.size()
         );
 
         if (bytesRead < 0) {
@@ -242,21 +341,7 @@ namespace DebugServer::Gdb
             throw ClientDisconnected();
         }
 
-        if (bytesRead != output.size()) {
-            output.resize(static_cast<unsigned long>(std::max(ssize_t{0}, bytesRead)));
-        }
-
-        return output;
-    }
-
-    std::optional<unsigned char> Connection::readSingleByte(bool interruptible) {
-        auto bytes = this->read(1, interruptible, std::chrono::milliseconds(300));
-
-        if (!bytes.empty()) {
-            return bytes.front();
-        }
-
-        return std::nullopt;
+        return static_cast<std::size_t>(bytesRead);
     }
 
     void Connection::write(const std::vector<unsigned char>& buffer) {
@@ -9,6 +9,7 @@
 #include <queue>
 #include <array>
 #include <chrono>
+#include <span>
 
 #include "src/Helpers/EventFdNotifier.hpp"
 #include "src/Helpers/EpollInstance.hpp"
@@ -31,6 +32,12 @@ namespace DebugServer::Gdb
          */
         static constexpr auto ABSOLUTE_MAXIMUM_PACKET_READ_SIZE = 2097000; // 2MiB
 
+        /**
+         * The size of the buffer we read incoming data into. Packets that exceed this size will span multiple reads,
+         * which is fine, as the packet parser is resumable. See Connection::parseRawPackets().
+         */
+        static constexpr auto RECEIVE_BUFFER_SIZE = 65536;
+
         explicit Connection(int serverSocketFileDescriptor, EventFdNotifier& interruptEventNotifier);
 
         Connection() = delete;
@@ -47,6 +54,13 @@ namespace DebugServer::Gdb
             , interruptEventNotifier(other.interruptEventNotifier)
             , epollInstance(std::move(other.epollInstance))
             , readInterruptEnabled(other.readInterruptEnabled)
+            , acknowledgementsEnabled(other.acknowledgementsEnabled)
+            , receiveBuffer(std::move(other.receiveBuffer))
+            , parserState(other.parserState)
+            , partialPacket(std::move(other.partialPacket))
+            , checksumBytesRead(other.checksumBytesRead)
+            , pendingPackets(std::move(other.pendingPackets))
+            , pendingAcknowledgements(std::move(other.pendingAcknowledgements))
         {
             other.socketFileDescriptor = std::nullopt;
         }
@@ -61,11 +75,14 @@ namespace DebugServer::Gdb
         [[nodiscard]] std::string getIpAddress() const;
 
         /**
-         * Waits for incoming data from the client and returns the raw GDB packets.
+         * Returns the next raw GDB packet from the client, waiting for incoming data if no packets are pending.
+         *
+         * Packets are returned in the order in which they were received. If the client sent more than one packet in
+         * a single instance, the remaining packets are held and returned by subsequent calls.
          *
          * @return
          */
-        std::vector<RawPacket> readRawPackets();
+        RawPacket readRawPacket();
 
         /**
          * Sends a response packet to the client.
@@ -74,6 +91,14 @@ namespace DebugServer::Gdb
          */
         void writePacket(const ResponsePackets::ResponsePacket& packet);
 
+        /**
+         * Stops acknowledging incoming packets, and stops waiting for acknowledgements of outgoing packets. This
+         * should only be called after the client has requested it, via the "QStartNoAckMode" packet.
+         */
+        void disableAcknowledgements() {
+            this->acknowledgementsEnabled = false;
+        }
+
     private:
         std::optional<int> socketFileDescriptor;
 
@@ -86,7 +111,7 @@ namespace DebugServer::Gdb
          *
          * The file descriptors of the eventfd object and the socket are both added to an EpollInstance (which is just
          * an RAII wrapper for a Linux epoll instance). The EpollInstance object is then used to wait for events on
-         * either of the two file descriptors. See any of the Connection I/O functions (e.g Connection::read()) for
+         * either of the two file descriptors. See any of the Connection I/O functions (e.g Connection::readInto()) for
          * more on this.
          *
          * See the EventFdNotifier and EpollInstance classes for more.
@@ -96,6 +121,40 @@ namespace DebugServer::Gdb
 
         bool readInterruptEnabled = false;
 
+        /**
+         * See Connection::disableAcknowledgements().
+         */
+        bool acknowledgementsEnabled = true;
+
+        std::vector<unsigned char> receiveBuffer;
+
+        /**
+         * Incoming data is parsed incrementally - a packet can span any number of reads. The state below is retained
+         * between reads. See Connection::parseRawPackets().
+         */
+        enum class PacketParserState: std::uint8_t
+        {
+            IDLE,
+            PACKET_DATA,
+            ESCAPED_BYTE,
+            CHECKSUM,
+        };
+
+        PacketParserState parserState = PacketParserState::IDLE;
+        RawPacket partialPacket;
+        std::uint8_t checksumBytesRead = 0;
+
+        /**
+         * Complete packets that are yet to be returned by Connection::readRawPacket().
+         */
+        std::queue<RawPacket> pendingPackets;
+
+        /**
+         * Acknowledgements ('+' or '-') received from the client, that are yet to be consumed by
+         * Connection::writePacket().
+         */
+        std::queue<unsigned char> pendingAcknowledgements;
+
         /**
          * Accepts a connection on serverSocketFileDescriptor.
          *
@@ -109,10 +168,9 @@ namespace DebugServer::Gdb
         void close() noexcept;
 
         /**
-         * Reads data from the client into a raw buffer.
+         * Reads data from the client into the given buffer.
          *
-         * @param bytes
-         *  Number of bytes to read.
+         * @param buffer
          *
          * @param interruptible
          *  If this flag is set to false, no other component within Bloom will be able to gracefully interrupt
@@ -123,22 +181,35 @@ namespace DebugServer::Gdb
          *  The timeout in milliseconds. If not supplied, no timeout will be applied.
          *
          * @return
+         *  The number of bytes read. Zero if the timeout was reached.
          */
-        std::vector<unsigned char> read(
-            std::optional<std::size_t> bytes = std::nullopt,
+        std::size_t readInto(
+            std::span<unsigned char> buffer,
             bool interruptible = true,
             std::optional<std::chrono::milliseconds> timeout = std::nullopt
         );
 
         /**
-         * Does the same as Connection::read(), but only reads a single byte.
+         * Parses the given data and queues any complete packets in this->pendingPackets. Any trailing partial packet
+         * is retained in this->partialPacket, and will be completed by subsequent calls.
          *
-         * @param interruptible
-         *  See Connection::read().
+         * Receipt of each complete packet is acknowledged immediately. Acknowledgements received from the client are
+         * queued in this->pendingAcknowledgements.
+         *
+         * @param buffer
+         */
+        void parseRawPackets(std::span<const unsigned char> buffer);
+
+        /**
+         * Waits for the client to acknowledge (or reject) the last packet we sent. Any other data received in the
+         * meantime is fed through the packet parser.
+         *
+         * Reads are not interruptible.
          *
          * @return
+         *  The acknowledgement byte ('+' or '-'), or std::nullopt if the client didn't respond in time.
          */
-        std::optional<unsigned char> readSingleByte(bool interruptible = true);
+        std::optional<unsigned char> waitForAcknowledgement();
 
         /**
          * Writes data from a raw buffer to the client connection.
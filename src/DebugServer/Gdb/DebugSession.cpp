@@ -1,6 +1,10 @@
 #include "DebugSession.hpp"
 
+#include <vector>
+
+#include "src/Services/StringService.hpp"
 #include "src/EventManager/EventManager.hpp"
+#include "src/Exceptions/Exception.hpp"
 
 namespace DebugServer::Gdb
 {
@@ -26,107 +30,137 @@ namespace DebugServer::Gdb
         EventManager::triggerEvent(std::make_shared<Events::DebugSessionFinished>());
     }
 
-    void DebugSession::setInternalBreakpoint(
-        Targets::TargetMemoryAddress address,
-        Services::TargetControllerService& targetControllerService
-    ) {
-        if (this->internalBreakpointsByAddress.contains(address)) {
-            return;
-        }
+    void DebugSession::setInternalBreakpoint(Targets::TargetMemoryAddress address) {
+        this->internalBreakpointAddresses.insert(address);
+    }
 
-        const auto externalBreakpointIt = this->externalBreakpointsByAddress.find(address);
+    void DebugSession::removeInternalBreakpoint(Targets::TargetMemoryAddress address) {
+        this->internalBreakpointAddresses.erase(address);
+    }
 
-        if (externalBreakpointIt != this->externalBreakpointsByAddress.end()) {
-            // We already have an external breakpoint at this address
-            this->internalBreakpointsByAddress.insert(std::pair(address, externalBreakpointIt->second));
-            return;
-        }
+    void DebugSession::setExternalBreakpoint(Targets::TargetMemoryAddress address) {
+        this->externalBreakpointAddresses.insert(address);
+    }
 
-        this->internalBreakpointsByAddress.insert(
-            std::pair(
-                address,
-                targetControllerService.setBreakpoint(address, Targets::TargetBreakpoint::Type::HARDWARE)
-            )
-        );
+    void DebugSession::removeExternalBreakpoint(Targets::TargetMemoryAddress address) {
+        this->externalBreakpointAddresses.erase(address);
     }
 
-    void DebugSession::removeInternalBreakpoint(
-        Targets::TargetMemoryAddress address,
-        Services::TargetControllerService& targetControllerService
-    ) {
-        const auto breakpointIt = this->internalBreakpointsByAddress.find(address);
-        if (breakpointIt == this->internalBreakpointsByAddress.end()) {
-            return;
+    void DebugSession::applyBreakpointChanges(Services::TargetControllerService& targetControllerService) {
+        auto breakpointAddresses = this->internalBreakpointAddresses;
+        breakpointAddresses.insert(this->externalBreakpointAddresses.begin(), this->externalBreakpointAddresses.end());
+
+        auto staleBreakpoints = std::vector<Targets::TargetBreakpoint>();
+        auto newBreakpointAddresses = std::vector<Targets::TargetMemoryAddress>();
+
+        for (const auto& [address, breakpoint] : this->installedBreakpointsByAddress) {
+            if (!breakpointAddresses.contains(address)) {
+                staleBreakpoints.push_back(breakpoint);
+            }
         }
 
-        if (!this->externalBreakpointsByAddress.contains(address)) {
-            targetControllerService.removeBreakpoint(breakpointIt->second);
+        for (const auto& address : breakpointAddresses) {
+            if (!this->installedBreakpointsByAddress.contains(address)) {
+                newBreakpointAddresses.push_back(address);
+            }
         }
 
-        this->internalBreakpointsByAddress.erase(breakpointIt);
-    }
+        if (!staleBreakpoints.empty()) {
+            // Remove stale breakpoints first, to free up any hardware breakpoint resources for the new ones
+            targetControllerService.removeBreakpoints(staleBreakpoints);
 
-    void DebugSession::setExternalBreakpoint(
-        Targets::TargetMemoryAddress address,
-        Services::TargetControllerService& targetControllerService
-    ) {
-        if (this->externalBreakpointsByAddress.contains(address)) {
-            return;
+            for (const auto& breakpoint : staleBreakpoints) {
+                this->installedBreakpointsByAddress.erase(breakpoint.address);
+            }
         }
 
-        const auto internalBreakpointIt = this->internalBreakpointsByAddress.find(address);
-
-        if (internalBreakpointIt != this->internalBreakpointsByAddress.end()) {
-            // We already have an internal breakpoint at this address
-            this->externalBreakpointsByAddress.insert(std::pair(address, internalBreakpointIt->second));
+        if (newBreakpointAddresses.empty()) {
             return;
         }
 
-        this->externalBreakpointsByAddress.insert(
-            std::pair(
-                address,
-                targetControllerService.setBreakpoint(address, Targets::TargetBreakpoint::Type::HARDWARE)
-            )
+        /*
+         * The TargetController will install as many of the breakpoints as it can, and return the ones it installed.
+         * Any that are missing from the response could not be installed.
+         */
+        const auto breakpoints = targetControllerService.setBreakpoints(
+            newBreakpointAddresses,
+            Targets::TargetBreakpoint::Type::HARDWARE
         );
+
+        for (const auto& breakpoint : breakpoints) {
+            this->installedBreakpointsByAddress.insert(std::pair(breakpoint.address, breakpoint));
+        }
+
+        auto failedAddresses = std::string();
+
+        for (const auto& address : newBreakpointAddresses) {
+            if (this->installedBreakpointsByAddress.contains(address)) {
+                continue;
+            }
+
+            // Forget the breakpoint, so that we don't attempt to install it again upon the next resume
+            this->internalBreakpointAddresses.erase(address);
+            this->externalBreakpointAddresses.erase(address);
+
+            failedAddresses += (failedAddresses.empty() ? "0x" : ", 0x") + Services::StringService::toHex(address);
+        }
+
+        if (!failedAddresses.empty()) {
+            throw Exceptions::Exception("Failed to install breakpoint(s) at byte address(es) " + failedAddresses);
+        }
     }
 
-    void DebugSession::removeExternalBreakpoint(
-        Targets::TargetMemoryAddress address,
-        Services::TargetControllerService& targetControllerService
-    ) {
-        const auto breakpointIt = this->externalBreakpointsByAddress.find(address);
-        if (breakpointIt == this->externalBreakpointsByAddress.end()) {
+    void DebugSession::removeAllBreakpoints(Services::TargetControllerService& targetControllerService) {
+        this->internalBreakpointAddresses.clear();
+        this->externalBreakpointAddresses.clear();
+
+        if (this->installedBreakpointsByAddress.empty()) {
             return;
         }
 
-        if (!this->internalBreakpointsByAddress.contains(address)) {
-            targetControllerService.removeBreakpoint(breakpointIt->second);
+        if (targetControllerService.getTargetState() != Targets::TargetState::STOPPED) {
+            // Breakpoints can only be removed whilst the target is stopped
+            targetControllerService.stopTargetExecution();
         }
 
-        this->externalBreakpointsByAddress.erase(breakpointIt);
+        this->applyBreakpointChanges(targetControllerService);
     }
 
-    void DebugSession::startRangeSteppingSession(
-        RangeSteppingSession&& session,
-        Services::TargetControllerService& targetControllerService
-    ) {
+    void DebugSession::startRangeSteppingSession(RangeSteppingSession&& session) {
         for (const auto& interceptAddress : session.interceptedAddresses) {
-            this->setInternalBreakpoint(interceptAddress, targetControllerService);
+            this->setInternalBreakpoint(interceptAddress);
         }
 
         this->activeRangeSteppingSession = std::move(session);
     }
 
-    void DebugSession::terminateRangeSteppingSession(Services::TargetControllerService& targetControllerService) {
+    void DebugSession::terminateRangeSteppingSession() {
         if (!this->activeRangeSteppingSession.has_value()) {
             return;
         }
 
-        // Clear all intercepting breakpoints
+        /*
+         * Clear all intercepting breakpoints. These will remain installed on the target until the next time we apply
+         * breakpoint changes - if the next range stepping session intercepts the same addresses, they'll never be
+         * removed.
+         */
         for (const auto& interceptAddress : this->activeRangeSteppingSession->interceptedAddresses) {
-            this->removeInternalBreakpoint(interceptAddress, targetControllerService);
+            this->removeInternalBreakpoint(interceptAddress);
         }
 
         this->activeRangeSteppingSession.reset();
     }
+
+    void DebugSession::terminateProgrammingSession(Services::TargetControllerService& targetControllerService) {
+        if (!this->programmingSession.has_value()) {
+            return;
+        }
+
+        try {
+            this->programmingSession->waitForPendingWrites(targetControllerService);
+
+        } catch (const Exceptions::Exception&) {}
+
+        this->programmingSession.reset();
+    }
 }
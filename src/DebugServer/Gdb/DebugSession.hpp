@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <optional>
 #include <map>
+#include <set>
 
 #include "TargetDescriptor.hpp"
 #include "GdbDebugServerConfig.hpp"
@@ -54,9 +55,23 @@ namespace DebugServer::Gdb
          *   to be external breakpoints.
          *
          * We track internal and external breakpoints separately.
+         *
+         * Setting or removing a breakpoint only updates these sets. The changes are applied to the target, as a
+         * single batch, just before the target is resumed or stepped (see DebugSession::applyBreakpointChanges()).
+         * This means breakpoints that are set and then removed (or vice versa) whilst the target is stopped never
+         * reach the debug tool, which is particularly beneficial on debugWire targets, where each software breakpoint
+         * change results in a program memory page write.
+         *
+         * A consequence of this is that we can't report a failure to install a breakpoint in response to the Z
+         * packet. Instead, the failure is reported in response to the packet that resumed or stepped the target.
+         */
+        std::set<Targets::TargetMemoryAddress> internalBreakpointAddresses;
+        std::set<Targets::TargetMemoryAddress> externalBreakpointAddresses;
+
+        /**
+         * The breakpoints currently installed on the target, by this debug session.
          */
-        std::map<Targets::TargetMemoryAddress, Targets::TargetBreakpoint> internalBreakpointsByAddress;
-        std::map<Targets::TargetMemoryAddress, Targets::TargetBreakpoint> externalBreakpointsByAddress;
+        std::map<Targets::TargetMemoryAddress, Targets::TargetBreakpoint> installedBreakpointsByAddress;
 
         /**
          * When the GDB client is waiting for the target to halt, this is set to true so we know when to notify the
@@ -68,11 +83,12 @@ namespace DebugServer::Gdb
 
         /**
          * When the user attempts to program the target via GDB's 'load' command, GDB will send a number of
-         * FlashWrite (vFlashWrite) packets to Bloom. We group the data in these packets and flush it all at once, upon
-         * receiving a FlashDone (vFlashDone) packet.
+         * FlashWrite (vFlashWrite) packets to Bloom. We buffer the data in these packets and hand it over to the
+         * TargetController, one or more pages at a time, as it arrives. Upon receiving a FlashDone (vFlashDone)
+         * packet, we flush what remains and wait for all writes to complete.
          *
-         * The grouped data is held in a ProgrammingSession object, against the active debug session. Once the data has
-         * been flushed, the ProgrammingSession object is destroyed.
+         * The buffered data and pending writes are held in a ProgrammingSession object, against the active debug
+         * session. Once programming has completed, the ProgrammingSession object is destroyed.
          *
          * See the ProgrammingSession struct and GDB RSP documentation for more.
          *
@@ -104,33 +120,47 @@ namespace DebugServer::Gdb
 
         virtual ~DebugSession();
 
-        virtual void setInternalBreakpoint(
-            Targets::TargetMemoryAddress address,
-            Services::TargetControllerService& targetControllerService
-        );
+        virtual void setInternalBreakpoint(Targets::TargetMemoryAddress address);
+        virtual void removeInternalBreakpoint(Targets::TargetMemoryAddress address);
 
-        virtual void removeInternalBreakpoint(
-            Targets::TargetMemoryAddress address,
-            Services::TargetControllerService& targetControllerService
-        );
+        virtual void setExternalBreakpoint(Targets::TargetMemoryAddress address);
+        virtual void removeExternalBreakpoint(Targets::TargetMemoryAddress address);
 
-        virtual void setExternalBreakpoint(
-            Targets::TargetMemoryAddress address,
-            Services::TargetControllerService& targetControllerService
-        );
+        /**
+         * Installs and removes breakpoints on the target, such that the installed breakpoints match the internal and
+         * external breakpoints recorded in this session.
+         *
+         * This must be called before resuming or stepping target execution.
+         *
+         * @param targetControllerService
+         *
+         * @throws Exceptions::Exception
+         *  If any of the breakpoints could not be installed. Those that were installed are recorded, and those that
+         *  weren't are forgotten.
+         */
+        virtual void applyBreakpointChanges(Services::TargetControllerService& targetControllerService);
 
-        virtual void removeExternalBreakpoint(
-            Targets::TargetMemoryAddress address,
-            Services::TargetControllerService& targetControllerService
-        );
+        /**
+         * Forgets all internal and external breakpoints and removes all installed breakpoints from the target,
+         * stopping target execution if necessary.
+         *
+         * This must be called before the debug session ends, otherwise any breakpoints that were installed on the
+         * target will remain there after GDB has gone.
+         *
+         * @param targetControllerService
+         */
+        virtual void removeAllBreakpoints(Services::TargetControllerService& targetControllerService);
 
-        virtual void startRangeSteppingSession(
-            RangeSteppingSession&& session,
-            Services::TargetControllerService& targetControllerService
-        );
+        virtual void startRangeSteppingSession(RangeSteppingSession&& session);
+        virtual void terminateRangeSteppingSession();
 
-        virtual void terminateRangeSteppingSession(
-            Services::TargetControllerService& targetControllerService
-        );
+        /**
+         * Abandons the current programming session (if any), after waiting for any pending writes to complete.
+         *
+         * Failed writes are ignored here - this is only used when programming has already failed.
+         *
+         * @param targetControllerService
+         */
+        virtual void terminateProgrammingSession(Services::TargetControllerService& targetControllerService);
     };
 }
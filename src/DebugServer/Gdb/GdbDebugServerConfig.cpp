@@ -42,5 +42,17 @@ namespace DebugServer::Gdb
                 );
             }
         }
+
+        if (debugServerConfig.debugServerNode["differentialProgramming"]) {
+            if (YamlUtilities::isCastable<bool>(debugServerConfig.debugServerNode["differentialProgramming"])) {
+                this->differentialProgramming = debugServerConfig.debugServerNode["differentialProgramming"].as<bool>();
+
+            } else {
+                Logger::error(
+                    "Invalid GDB debug server config parameter ('differentialProgramming') provided - value must be "
+                    "castable to a boolean. The parameter will be ignored."
+                );
+            }
+        }
     }
 }
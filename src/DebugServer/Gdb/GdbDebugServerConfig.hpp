@@ -35,6 +35,21 @@ namespace DebugServer::Gdb
          */
         bool rangeStepping = true;
 
+        /**
+         * Controls differential programming.
+         *
+         * If this is set to true, the GDB server will compare the program received from GDB (via the "load"
+         * command) with the target's current program memory, and only write the pages that have changed. On
+         * targets that require an erase before programming, the erase will be skipped entirely if nothing has
+         * changed.
+         *
+         * Note: program memory outside of the loaded program will not be erased if the erase is skipped. The erase
+         * can only be skipped for programs of up to 128KiB - larger programs are always erased and written in full.
+         *
+         * This parameter is optional. If not specified, the default value set here will be used.
+         */
+        bool differentialProgramming = true;
+
         explicit GdbDebugServerConfig(const DebugServerConfig& debugServerConfig);
     };
 }
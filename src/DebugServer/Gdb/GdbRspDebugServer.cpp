@@ -31,6 +31,8 @@
 #include "CommandPackets/GenerateSvd.hpp"
 #include "CommandPackets/Detach.hpp"
 #include "CommandPackets/EepromFill.hpp"
+#include "CommandPackets/CacheInfo.hpp"
+#include "CommandPackets/StartNoAckMode.hpp"
 
 #ifndef EXCLUDE_INSIGHT
 #include "CommandPackets/ActivateInsight.hpp"
@@ -215,22 +217,11 @@ namespace DebugServer::Gdb
     }
 
     std::unique_ptr<CommandPacket> GdbRspDebugServer::waitForCommandPacket() {
-        auto* debugSession = this->getActiveDebugSession();
-        const auto rawPackets = debugSession->connection.readRawPackets();
-
-        if (rawPackets.size() > 1) {
-            const auto& firstRawPacket = rawPackets.front();
-
-            if (firstRawPacket.size() == 5 && firstRawPacket[1] == 0x03) {
-                // Interrupt packet that came in too quickly before another packet
-                debugSession->pendingInterrupt = true;
-            }
-
-            // We only process the last packet - any others will probably be duplicates from an impatient client.
-            Logger::warning("Multiple packets received from GDB - only the most recent will be processed");
-        }
-
-        return this->resolveCommandPacket(rawPackets.back());
+        /*
+         * Packets are processed in the order in which they were received. An interrupt packet that arrives ahead of
+         * another packet will be handled first (see CommandPackets::InterruptExecution::handle()).
+         */
+        return this->resolveCommandPacket(this->getActiveDebugSession()->connection.readRawPacket());
     }
 
     std::unique_ptr<CommandPacket> GdbRspDebugServer::resolveCommandPacket(const RawPacket& rawPacket) {
@@ -254,6 +245,10 @@ namespace DebugServer::Gdb
                 return std::make_unique<CommandPackets::SupportedFeaturesQuery>(rawPacket);
             }
 
+            if (rawPacketString.find("QStartNoAckMode") == 1) {
+                return std::make_unique<CommandPackets::StartNoAckMode>(rawPacket);
+            }
+
             if (rawPacketString[1] == 'c') {
                 return std::make_unique<CommandPackets::ContinueExecution>(rawPacket);
             }
@@ -297,6 +292,10 @@ namespace DebugServer::Gdb
                 if (monitorCommand->command.find("eeprom fill") == 0) {
                     return std::make_unique<CommandPackets::EepromFill>(std::move(*(monitorCommand.release())));
                 }
+
+                if (monitorCommand->command == "cache") {
+                    return std::make_unique<CommandPackets::CacheInfo>(std::move(*(monitorCommand.release())));
+                }
 #ifndef EXCLUDE_INSIGHT
                 if (monitorCommand->command.find("insight") == 0) {
                     return std::make_unique<CommandPackets::ActivateInsight>(std::move(*(monitorCommand.release())));
@@ -374,13 +373,21 @@ namespace DebugServer::Gdb
         auto* debugSession = this->getActiveDebugSession();
 
         if (debugSession->activeRangeSteppingSession.has_value()) {
-            debugSession->terminateRangeSteppingSession(this->targetControllerService);
+            debugSession->terminateRangeSteppingSession();
         }
 
-        debugSession->connection.writePacket(ResponsePackets::TargetStopped(Signal::TRAP));
+        debugSession->connection.writePacket(
+            ResponsePackets::TargetStopped(Signal::TRAP, std::nullopt, this->getExpeditedRegisters(programAddress))
+        );
         debugSession->waitingForBreak = false;
     }
 
+    std::map<GdbRegisterId, std::vector<unsigned char>> GdbRspDebugServer::getExpeditedRegisters(
+        Targets::TargetMemoryAddress programAddress
+    ) {
+        return {};
+    }
+
     void GdbRspDebugServer::handleTargetResumedGdbResponse() {
         auto* debugSession = this->getActiveDebugSession();
 
@@ -389,7 +396,7 @@ namespace DebugServer::Gdb
             this->targetControllerService.stopTargetExecution();
 
             if (debugSession->activeRangeSteppingSession.has_value()) {
-                debugSession->terminateRangeSteppingSession(this->targetControllerService);
+                debugSession->terminateRangeSteppingSession();
             }
 
             debugSession->connection.writePacket(ResponsePackets::TargetStopped(Signal::INTERRUPTED));
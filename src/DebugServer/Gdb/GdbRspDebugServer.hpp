@@ -4,6 +4,7 @@
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <vector>
+#include <map>
 #include <queue>
 #include <optional>
 #include <memory>
@@ -201,5 +202,23 @@ namespace DebugServer::Gdb
 
         virtual void handleTargetStoppedGdbResponse(Targets::TargetMemoryAddress programAddress);
         virtual void handleTargetResumedGdbResponse();
+
+        /**
+         * Should return the register values to be included in the stop reply packet, when reporting a stop to GDB,
+         * mapped by GDB register ID.
+         *
+         * GDB needs the program counter, stack pointer and frame pointer to identify the current frame, after every
+         * stop. Including them in the stop reply saves GDB from requesting all of the target's registers.
+         *
+         * The default implementation returns an empty map - no registers will be included in the stop reply.
+         *
+         * @param programAddress
+         *  The program counter value, as reported in the TargetExecutionStopped event.
+         *
+         * @return
+         */
+        virtual std::map<GdbRegisterId, std::vector<unsigned char>> getExpeditedRegisters(
+            Targets::TargetMemoryAddress programAddress
+        );
     };
 }
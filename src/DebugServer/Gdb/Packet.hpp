@@ -3,9 +3,8 @@
 #include <vector>
 #include <memory>
 #include <numeric>
-#include <QString>
-#include <sstream>
-#include <iomanip>
+
+#include "src/Services/StringService.hpp"
 
 namespace DebugServer::Gdb
 {
@@ -39,14 +38,21 @@ namespace DebugServer::Gdb
          */
         [[nodiscard]] RawPacket toRawPacket() const {
             std::vector<unsigned char> packet = {'$'};
+            packet.reserve(this->data.size() + 4);
 
             for (const auto& byte : this->data) {
-                // Escape $ and # characters
+                /*
+                 * Escape the framing ($ and #), escape (}) and run-length encoding (*) characters. Escaping the
+                 * latter two is only necessary for binary data, but it's harmless for everything else.
+                 */
                 switch (byte) {
                     case '$':
-                    case '#': {
+                    case '#':
+                    case '}':
+                    case '*': {
                         packet.push_back('}');
                         packet.push_back(byte ^ 0x20);
+                        break;
                     }
                     default: {
                         packet.push_back(byte);
@@ -54,22 +60,12 @@ namespace DebugServer::Gdb
                 }
             }
 
-            auto dataSum = std::accumulate(packet.begin() + 1, packet.end(), 0);
+            const auto checksum = Services::StringService::toHex(
+                static_cast<unsigned char>(std::accumulate(packet.begin() + 1, packet.end(), 0) % 256)
+            );
             packet.push_back('#');
-            auto checkSum = QStringLiteral("%1").arg(dataSum % 256, 2, 16, QLatin1Char('0')).toStdString();
-
-            if (checkSum.size() < 2) {
-                packet.push_back('0');
-
-                if (checkSum.size() < 1) {
-                    packet.push_back('0');
-                } else {
-                    packet.push_back(static_cast<unsigned char>(checkSum[0]));
-                }
-            }
-
-            packet.push_back(static_cast<unsigned char>(checkSum[0]));
-            packet.push_back(static_cast<unsigned char>(checkSum[1]));
+            packet.push_back(static_cast<unsigned char>(checksum[0]));
+            packet.push_back(static_cast<unsigned char>(checksum[1]));
 
             return packet;
         }
@@ -81,14 +77,7 @@ namespace DebugServer::Gdb
          * @return
          */
         static std::vector<unsigned char> hexToData(const std::string& hexData) {
-            std::vector<unsigned char> output;
-
-            for (auto i = 0; i < hexData.size(); i += 2) {
-                auto hexByte = std::string((hexData.begin() + i), (hexData.begin() + i + 2));
-                output.push_back(static_cast<unsigned char>(std::stoi(hexByte, nullptr, 16)));
-            }
-
-            return output;
+            return Services::StringService::dataFromHex(hexData);
         }
 
     protected:
@@ -0,0 +1,284 @@
+#include "ProgrammingSession.hpp"
+
+#include <optional>
+#include <algorithm>
+
+#include "src/Logger/Logger.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace DebugServer::Gdb
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+    using Targets::TargetMemoryAddressRange;
+
+    using Exceptions::Exception;
+
+    ProgrammingSession::ProgrammingSession(
+        const Targets::TargetMemoryDescriptor& programMemoryDescriptor,
+        bool differential
+    )
+        : pageSize(programMemoryDescriptor.pageSize.value_or(1))
+        , differential(differential)
+        , writeRequiresErase(programMemoryDescriptor.writeRequiresErase)
+    {}
+
+    void ProgrammingSession::appendData(TargetMemoryAddress dataStartAddress, const Targets::TargetMemoryBuffer& data) {
+        if (this->totalBytes == 0) {
+            this->startAddress = dataStartAddress;
+            this->comparedEndAddress = dataStartAddress;
+
+        } else {
+            const auto expectedStartAddress = static_cast<TargetMemoryAddress>(
+                this->startAddress + this->buffer.size()
+            );
+
+            if (dataStartAddress < expectedStartAddress) {
+                throw Exception("Invalid start address from GDB - the buffer would overlap a previous buffer");
+            }
+
+            if (dataStartAddress > expectedStartAddress) {
+                // There is a gap in the buffer sent by GDB. Fill it with 0xFF
+                const auto gapSize = dataStartAddress - expectedStartAddress;
+                this->buffer.insert(this->buffer.end(), gapSize, 0xFF);
+                this->totalBytes += gapSize;
+            }
+        }
+
+        this->buffer.insert(this->buffer.end(), data.begin(), data.end());
+        this->totalBytes += static_cast<TargetMemorySize>(data.size());
+    }
+
+    void ProgrammingSession::enableProgrammingMode(Services::TargetControllerService& targetControllerService) {
+        if (this->programmingModeEnabled) {
+            return;
+        }
+
+        targetControllerService.enableProgrammingMode();
+        this->programmingModeEnabled = true;
+    }
+
+    void ProgrammingSession::erase(Services::TargetControllerService& targetControllerService) {
+        if (this->differential && this->writeRequiresErase) {
+            /*
+             * We don't know if we need to erase the program memory until we've seen the data. We'll perform the
+             * erase upon finding the first page that differs from the target's current program memory, if any.
+             */
+            Logger::debug("Deferring program memory erase");
+            this->erasePending = true;
+            return;
+        }
+
+        if (this->differential) {
+            // Writes will take care of erasing the pages that have changed - no need to erase anything here
+            return;
+        }
+
+        this->enableProgrammingMode(targetControllerService);
+
+        Logger::warning("Erasing program memory, in preparation for programming");
+        targetControllerService.eraseMemory(Targets::TargetMemoryType::FLASH);
+    }
+
+    void ProgrammingSession::writeCompletePages(Services::TargetControllerService& targetControllerService) {
+        const auto bufferEndAddress = static_cast<TargetMemoryAddress>(this->startAddress + this->buffer.size());
+
+        // Only write up to the last page boundary - the rest will be written once we have the complete page
+        const auto writeEndAddress = bufferEndAddress - (bufferEndAddress % this->pageSize);
+
+        if (writeEndAddress <= this->startAddress) {
+            return;
+        }
+
+        this->writeUpTo(writeEndAddress, targetControllerService);
+    }
+
+    void ProgrammingSession::complete(Services::TargetControllerService& targetControllerService) {
+        if (!this->buffer.empty()) {
+            this->writeUpTo(
+                static_cast<TargetMemoryAddress>(this->startAddress + this->buffer.size()),
+                targetControllerService
+            );
+        }
+
+        if (this->erasePending) {
+            // Nothing has changed - everything we've held in the buffer is already in the target's program memory
+            this->skippedBytes += static_cast<TargetMemorySize>(this->buffer.size());
+            this->discard(static_cast<TargetMemorySize>(this->buffer.size()));
+            this->erasePending = false;
+        }
+
+        this->waitForPendingWrites(targetControllerService);
+    }
+
+    void ProgrammingSession::waitForPendingWrites(Services::TargetControllerService& targetControllerService) {
+        auto error = std::optional<Exception>();
+
+        while (!this->pendingWriteCommandIds.empty()) {
+            const auto commandId = this->pendingWriteCommandIds.front();
+            this->pendingWriteCommandIds.pop();
+
+            try {
+                targetControllerService.waitForMemoryWrite(commandId);
+
+            } catch (const Exception& exception) {
+                if (!error.has_value()) {
+                    error = exception;
+                }
+            }
+        }
+
+        if (error.has_value()) {
+            throw *error;
+        }
+    }
+
+    void ProgrammingSession::writeUpTo(
+        TargetMemoryAddress endAddress,
+        Services::TargetControllerService& targetControllerService
+    ) {
+        if (!this->differential) {
+            this->startWrite(endAddress - this->startAddress, targetControllerService);
+            return;
+        }
+
+        if (this->erasePending) {
+            /*
+             * We're holding the data until we find a page that differs. We only need to compare the data we haven't
+             * already compared.
+             */
+            const auto compareStartAddress = std::max(this->startAddress, this->comparedEndAddress);
+
+            const auto programChanged = compareStartAddress < endAddress
+                && !this->getChangedRanges(
+                    TargetMemoryAddressRange(compareStartAddress, endAddress - 1),
+                    targetControllerService
+                ).empty();
+
+            const auto holdLimitReached = (endAddress - this->startAddress) >= ProgrammingSession::MAX_HELD_BYTES;
+
+            if (programChanged || holdLimitReached) {
+                /*
+                 * Either the program has changed, or we're holding too much data. We have to erase the program
+                 * memory and then write everything, including the data we've been holding.
+                 */
+                Logger::debug(
+                    programChanged
+                        ? "Program memory has changed - performing deferred erase"
+                        : "Held data limit reached - performing deferred erase"
+                );
+
+                this->erasePending = false;
+                this->differential = false;
+                this->erase(targetControllerService);
+
+                this->startWrite(endAddress - this->startAddress, targetControllerService);
+                return;
+            }
+
+            this->comparedEndAddress = endAddress;
+            return;
+        }
+
+        const auto changedRanges = this->getChangedRanges(
+            TargetMemoryAddressRange(this->startAddress, endAddress - 1),
+            targetControllerService
+        );
+
+        for (const auto& changedRange : changedRanges) {
+            const auto unchangedBytes = changedRange.startAddress - this->startAddress;
+            this->skippedBytes += unchangedBytes;
+            this->discard(unchangedBytes);
+
+            this->startWrite(changedRange.endAddress - changedRange.startAddress + 1, targetControllerService);
+        }
+
+        const auto unchangedBytes = endAddress - this->startAddress;
+        this->skippedBytes += unchangedBytes;
+        this->discard(unchangedBytes);
+    }
+
+    std::vector<TargetMemoryAddressRange> ProgrammingSession::getChangedRanges(
+        const TargetMemoryAddressRange& addressRange,
+        Services::TargetControllerService& targetControllerService
+    ) {
+        auto output = std::vector<TargetMemoryAddressRange>();
+
+        // We bypass the TargetController's caches, as a stale cache would have us skip pages that need writing
+        const auto currentData = targetControllerService.readMemory(
+            Targets::TargetMemoryType::FLASH,
+            addressRange.startAddress,
+            addressRange.endAddress - addressRange.startAddress + 1,
+            true
+        );
+
+        const auto bufferOffset = addressRange.startAddress - this->startAddress;
+
+        auto pageStartAddress = addressRange.startAddress;
+        while (pageStartAddress <= addressRange.endAddress) {
+            const auto pageEndAddress = std::min(
+                static_cast<TargetMemoryAddress>(
+                    pageStartAddress - (pageStartAddress % this->pageSize) + this->pageSize - 1
+                ),
+                addressRange.endAddress
+            );
+
+            const auto pageOffset = pageStartAddress - addressRange.startAddress;
+            const auto pageBytes = pageEndAddress - pageStartAddress + 1;
+
+            const auto pageChanged = !std::equal(
+                this->buffer.begin() + bufferOffset + pageOffset,
+                this->buffer.begin() + bufferOffset + pageOffset + pageBytes,
+                currentData.begin() + pageOffset
+            );
+
+            if (pageChanged) {
+                if (!output.empty() && output.back().endAddress == pageStartAddress - 1) {
+                    output.back().endAddress = pageEndAddress;
+
+                } else {
+                    output.emplace_back(pageStartAddress, pageEndAddress);
+                }
+            }
+
+            pageStartAddress = pageEndAddress + 1;
+        }
+
+        return output;
+    }
+
+    void ProgrammingSession::discard(TargetMemorySize bytes) {
+        this->buffer.erase(this->buffer.begin(), this->buffer.begin() + bytes);
+        this->startAddress += bytes;
+    }
+
+    void ProgrammingSession::startWrite(
+        TargetMemorySize bytes,
+        Services::TargetControllerService& targetControllerService
+    ) {
+        this->enableProgrammingMode(targetControllerService);
+
+        // Limit the number of writes in flight, to keep the amount of buffered data bounded
+        while (this->pendingWriteCommandIds.size() >= ProgrammingSession::MAX_PENDING_WRITES) {
+            const auto commandId = this->pendingWriteCommandIds.front();
+            this->pendingWriteCommandIds.pop();
+
+            try {
+                targetControllerService.waitForMemoryWrite(commandId);
+
+            } catch (const Exception& exception) {
+                this->waitForPendingWrites(targetControllerService);
+                throw exception;
+            }
+        }
+
+        auto writeBuffer = Targets::TargetMemoryBuffer(this->buffer.begin(), this->buffer.begin() + bytes);
+        this->discard(bytes);
+
+        this->pendingWriteCommandIds.push(targetControllerService.startMemoryWrite(
+            Targets::TargetMemoryType::FLASH,
+            this->startAddress - bytes,
+            std::move(writeBuffer)
+        ));
+    }
+}
@@ -1,29 +1,195 @@
 #pragma once
 
+#include <cstdint>
+#include <queue>
+#include <vector>
+#include <chrono>
+
 #include "src/Targets/TargetMemory.hpp"
+#include "src/TargetController/Commands/Command.hpp"
+#include "src/Services/TargetControllerService.hpp"
 
 namespace DebugServer::Gdb
 {
     /**
-     * A programming session is created upon receiving the first FlashWrite (vFlashWrite) packet from GDB.
+     * A programming session is created upon receiving the first FlashErase (vFlashErase) or FlashWrite (vFlashWrite)
+     * packet from GDB.
+     *
+     * The data received in FlashWrite packets is buffered here, until we have at least one complete page. Complete
+     * pages are then handed over to the TargetController, to be written in the background, whilst we continue to
+     * receive data from GDB. Upon receiving a FlashDone (vFlashDone) packet, we write whatever data remains in the
+     * buffer, wait for all writes to complete, and then destroy the programming session.
      *
-     * The programming session holds the start address and a single buffer, which contains the sum of the numerous
-     * buffers received by GDB (via multiple FlashWrite packets). Upon receiving a FlashDone (vFlashDone) packet, we
-     * write the whole buffer to the target's program memory and then destroy the programming session.
+     * In differential mode, complete pages are compared with the target's current program memory before they're
+     * written:
+     *  - If the program memory can be written without a prior erase, only the pages that differ are written.
+     *  - Otherwise, the erase is deferred until we find the first page that differs. Until then, the data is held in
+     *    the buffer. If no pages differ, we skip the erase and all writes. To bound the amount of data held, we give
+     *    up on deferring the erase once we're holding ProgrammingSession::MAX_HELD_BYTES.
      *
-     * See FlashWrite::handle() and FlashDone::handle() for more.
+     * See FlashErase::handle(), FlashWrite::handle() and FlashDone::handle() for more.
      */
     struct ProgrammingSession
     {
+        /**
+         * The maximum number of writes we allow to be pending at any one time. This bounds the amount of data held
+         * in the TargetController's command queue.
+         */
+        static constexpr auto MAX_PENDING_WRITES = 2;
+
+        /**
+         * The maximum number of bytes we hold in the buffer whilst an erase is pending (in differential mode). Once
+         * reached, we perform the erase and write everything we've been holding, even if it's unchanged.
+         */
+        static constexpr auto MAX_HELD_BYTES = Targets::TargetMemorySize{128 * 1024};
+
+        /**
+         * The address of the first byte in the buffer.
+         */
         Targets::TargetMemoryAddress startAddress = 0x00;
+
+        /**
+         * Data received from GDB, which has yet to be handed over to the TargetController.
+         */
         Targets::TargetMemoryBuffer buffer;
 
-        ProgrammingSession(
-            Targets::TargetMemoryAddress startAddress,
-            const Targets::TargetMemoryBuffer& initialBuffer
-        )
-            : startAddress(startAddress)
-            , buffer(initialBuffer)
-        {};
+        /**
+         * The total number of bytes received from GDB, in this session (including any gap fill bytes).
+         */
+        Targets::TargetMemorySize totalBytes = 0;
+
+        /**
+         * The number of bytes that were found to be unchanged, and were therefore not written.
+         */
+        Targets::TargetMemorySize skippedBytes = 0;
+
+        /**
+         * The program memory page size.
+         */
+        Targets::TargetMemorySize pageSize = 1;
+
+        /**
+         * Whether we should compare the data with the target's current program memory, and skip unchanged pages.
+         */
+        bool differential = false;
+
+        /**
+         * Whether the program memory must be erased before it can be written to.
+         */
+        bool writeRequiresErase = false;
+
+        /**
+         * Set when GDB has requested an erase, but we've deferred it (in differential mode).
+         */
+        bool erasePending = false;
+
+        /**
+         * The end address (exclusive) of the buffered data that has been found to match the target's current program
+         * memory, whilst we're holding data for a pending erase.
+         */
+        Targets::TargetMemoryAddress comparedEndAddress = 0x00;
+
+        /**
+         * Whether we've enabled programming mode on the target.
+         */
+        bool programmingModeEnabled = false;
+
+        /**
+         * IDs of the write commands that we've handed over to the TargetController, but for which we've not yet
+         * received a response. Oldest first.
+         */
+        std::queue<TargetController::Commands::CommandIdType> pendingWriteCommandIds;
+
+        /**
+         * When the session started - used to report how long programming took.
+         */
+        std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+        ProgrammingSession(const Targets::TargetMemoryDescriptor& programMemoryDescriptor, bool differential);
+
+        /**
+         * Appends data received from GDB to the buffer, filling any gap between the buffered data and the given
+         * start address with 0xFF.
+         *
+         * @param dataStartAddress
+         * @param data
+         */
+        void appendData(Targets::TargetMemoryAddress dataStartAddress, const Targets::TargetMemoryBuffer& data);
+
+        /**
+         * Enables programming mode on the target, if we haven't already done so.
+         *
+         * @param targetControllerService
+         */
+        void enableProgrammingMode(Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Erases the target's program memory, or defers the erase if we're in differential mode.
+         *
+         * @param targetControllerService
+         */
+        void erase(Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Hands all complete pages in the buffer over to the TargetController. Any partial page at the end of the
+         * buffer will remain in the buffer.
+         *
+         * @param targetControllerService
+         */
+        void writeCompletePages(Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Hands the remaining data in the buffer over to the TargetController and waits for all pending writes to
+         * complete.
+         *
+         * @param targetControllerService
+         */
+        void complete(Services::TargetControllerService& targetControllerService);
+
+        /**
+         * Waits for all pending writes to complete.
+         *
+         * Throws an exception if any of the writes failed. In that case, the remaining writes will still be waited
+         * on, so that the TargetController isn't left holding their responses.
+         *
+         * @param targetControllerService
+         */
+        void waitForPendingWrites(Services::TargetControllerService& targetControllerService);
+
+    private:
+        /**
+         * Writes the buffered data up to the given (exclusive) end address, skipping unchanged pages in differential
+         * mode.
+         *
+         * @param endAddress
+         * @param targetControllerService
+         */
+        void writeUpTo(
+            Targets::TargetMemoryAddress endAddress,
+            Services::TargetControllerService& targetControllerService
+        );
+
+        /**
+         * Compares the buffered data in the given address range with the target's current program memory, and
+         * returns the address ranges of the pages that differ. Consecutive pages are merged into a single range.
+         *
+         * The target's program memory is read from the target, bypassing the TargetController's caches.
+         *
+         * @param addressRange
+         * @param targetControllerService
+         *
+         * @return
+         */
+        std::vector<Targets::TargetMemoryAddressRange> getChangedRanges(
+            const Targets::TargetMemoryAddressRange& addressRange,
+            Services::TargetControllerService& targetControllerService
+        );
+
+        void discard(Targets::TargetMemorySize bytes);
+
+        void startWrite(
+            Targets::TargetMemorySize bytes,
+            Services::TargetControllerService& targetControllerService
+        );
     };
 }
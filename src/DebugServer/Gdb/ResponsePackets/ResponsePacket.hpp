@@ -19,6 +19,10 @@ namespace DebugServer::Gdb::ResponsePackets
             this->data = data;
         }
 
+        explicit ResponsePacket(std::vector<unsigned char>&& data) {
+            this->data = std::move(data);
+        }
+
         explicit ResponsePacket(const std::string& data) {
             this->data = std::vector<unsigned char>(data.begin(), data.end());
         }
@@ -1,11 +1,14 @@
 #pragma once
 
 #include <optional>
+#include <map>
+#include <vector>
 
 #include "ResponsePacket.hpp"
 
 #include "src/DebugServer/Gdb/Signal.hpp"
 #include "src/DebugServer/Gdb/StopReason.hpp"
+#include "src/DebugServer/Gdb/RegisterDescriptor.hpp"
 
 #include "src/Services/StringService.hpp"
 
@@ -14,6 +17,9 @@ namespace DebugServer::Gdb::ResponsePackets
     /**
      * The TargetStopped class implements the response packet structure for any commands that expect a "StopReply"
      * packet in response.
+     *
+     * The packet can carry the values of some registers ("expedited" registers), which saves GDB from having to
+     * request them separately, after every stop.
      */
     class TargetStopped: public ResponsePacket
     {
@@ -21,12 +27,28 @@ namespace DebugServer::Gdb::ResponsePackets
         Signal signal;
         std::optional<StopReason> stopReason;
 
-        explicit TargetStopped(Signal signal, const std::optional<StopReason>& stopReason = std::nullopt)
+        /**
+         * Register values, mapped by GDB register ID. The values are expected to be in the target's byte order (LSB
+         * first, for AVR targets).
+         */
+        std::map<GdbRegisterId, std::vector<unsigned char>> expeditedRegisters;
+
+        explicit TargetStopped(
+            Signal signal,
+            const std::optional<StopReason>& stopReason = std::nullopt,
+            const std::map<GdbRegisterId, std::vector<unsigned char>>& expeditedRegisters = {}
+        )
             : signal(signal)
             , stopReason(stopReason)
+            , expeditedRegisters(expeditedRegisters)
         {
             std::string packetData = "T" + Services::StringService::toHex(static_cast<unsigned char>(this->signal));
 
+            for (const auto& [registerId, registerValue] : this->expeditedRegisters) {
+                packetData += Services::StringService::toHex(static_cast<unsigned char>(registerId)) + ":"
+                    + Services::StringService::toHex(registerValue) + ";";
+            }
+
             if (this->stopReason.has_value()) {
                 static const auto stopReasonMapping = getStopReasonToNameMapping();
                 const auto stopReasonName = stopReasonMapping.valueAt(this->stopReason.value());
@@ -5,11 +5,17 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
     AvrCommand::AvrCommand(
         std::size_t fragmentCount,
         std::size_t fragmentNumber,
-        const std::vector<unsigned char>& commandPacket
+        std::span<const unsigned char> commandPacket
     )
+        : AvrCommand(fragmentCount, fragmentNumber, commandPacket.size())
+    {
+        // Packet data
+        this->data.insert(this->data.end(), commandPacket.begin(), commandPacket.end());
+    }
+
+    AvrCommand::AvrCommand(std::size_t fragmentCount, std::size_t fragmentNumber, std::size_t commandPacketSize)
         : Command(0x80)
     {
-        const auto commandPacketSize = commandPacket.size();
         this->data.reserve(commandPacketSize + 3);
 
         // FragmentInfo byte
@@ -18,10 +24,5 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
         // Size byte
         this->data.emplace_back(static_cast<unsigned char>(commandPacketSize >> 8));
         this->data.emplace_back(static_cast<unsigned char>(commandPacketSize & 0xFF));
-
-        if (commandPacketSize > 0) {
-            // Packet data
-            this->data.insert(this->data.begin() + 3, commandPacket.begin(), commandPacket.end());
-        }
     }
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <span>
 #include <cstdint>
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Command.hpp"
@@ -31,7 +32,17 @@ class AvrCommand: public ::DebugToolDrivers::Protocols::CmsisDap::Command
         AvrCommand(
             std::size_t fragmentCount,
             std::size_t fragmentNumber,
-            const std::vector<unsigned char>& commandPacket
+            std::span<const unsigned char> commandPacket
         );
+
+        /**
+         * Constructs an AvrCommand with an empty command packet of the given size. The caller is expected to append
+         * exactly commandPacketSize bytes to AvrCommand::data. Storage for the packet is reserved upfront.
+         *
+         * @param fragmentCount
+         * @param fragmentNumber
+         * @param commandPacketSize
+         */
+        AvrCommand(std::size_t fragmentCount, std::size_t fragmentNumber, std::size_t commandPacketSize);
     };
 }
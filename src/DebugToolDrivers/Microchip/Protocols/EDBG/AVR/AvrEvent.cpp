@@ -8,7 +8,7 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
 {
     using namespace Exceptions;
 
-    AvrEvent::AvrEvent(const std::vector<unsigned char>& rawResponse)
+    AvrEvent::AvrEvent(std::span<const unsigned char> rawResponse)
         : Response(rawResponse)
     {
         if (this->id != 0x82) {
@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <vector>
+#include <span>
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Response.hpp"
 
@@ -18,6 +19,6 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
         std::optional<AvrEventId> eventId = std::nullopt;
         std::vector<unsigned char> eventData = {};
 
-        explicit AvrEvent(const std::vector<unsigned char>& rawResponse);
+        explicit AvrEvent(std::span<const unsigned char> rawResponse);
     };
 }
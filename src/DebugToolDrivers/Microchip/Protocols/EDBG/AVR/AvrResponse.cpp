@@ -6,7 +6,7 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
 {
     using namespace Exceptions;
 
-    AvrResponse::AvrResponse(const std::vector<unsigned char>& rawResponse)
+    AvrResponse::AvrResponse(std::span<const unsigned char> rawResponse)
         : Response(rawResponse)
     {
         if (this->id != 0x81) {
@@ -26,16 +26,15 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
         this->fragmentCount = static_cast<std::uint8_t>(this->data[0] & 0x0FU);
         this->fragmentNumber = static_cast<std::uint8_t>(this->data[0] >> 4);
 
+        if (this->data.size() < 3) {
+            throw Exception("Failed to construct AvrResponse object - malformed AVR_RSP data");
+        }
+
         // Response size is two bytes, MSB
-        const auto responsePacketSize = static_cast<std::uint16_t>((this->data[1] << 8U) + this->data[2]);
-
-        if (responsePacketSize > 0) {
-            // Packet data
-            this->responsePacket.insert(
-                this->responsePacket.begin(),
-                this->data.begin() + 3,
-                this->data.begin() + 3 + responsePacketSize
-            );
+        this->responsePacketSize = static_cast<std::uint16_t>((this->data[1] << 8U) + this->data[2]);
+
+        if (this->data.size() < this->responsePacketSize + 3U) {
+            throw Exception("Failed to construct AvrResponse object - invalid size of AVR_RSP response packet");
         }
     }
 }
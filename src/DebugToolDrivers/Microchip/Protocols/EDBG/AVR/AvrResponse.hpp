@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <vector>
+#include <span>
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Response.hpp"
 
@@ -13,8 +14,23 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
         std::uint8_t fragmentNumber = 0;
         std::uint8_t fragmentCount = 0;
 
-        std::vector<unsigned char> responsePacket;
+        explicit AvrResponse(std::span<const unsigned char> rawResponse);
 
-        explicit AvrResponse(const std::vector<unsigned char>& rawResponse);
+        /**
+         * Returns the AVR response packet (a fragment of an AvrResponseFrame), without copying it out of the
+         * response data.
+         *
+         * @return
+         */
+        [[nodiscard]] std::span<const unsigned char> getResponsePacket() const {
+            if (this->responsePacketSize == 0) {
+                return {};
+            }
+
+            return std::span(this->data).subspan(3, this->responsePacketSize);
+        }
+
+    private:
+        std::uint16_t responsePacketSize = 0;
     };
 }
@@ -7,6 +7,7 @@
 #include <cmath>
 #include <atomic>
 #include <array>
+#include <algorithm>
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/Command.hpp"
 #include "src/DebugToolDrivers/Microchip/Protocols/EDBG/Edbg.hpp"
@@ -110,18 +111,13 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
          * @return
          */
         [[nodiscard]] auto getRawCommandFrame() const {
-            auto rawCommand = std::vector<unsigned char>(5 + this->payload.size());
+            const auto header = this->getRawCommandFrameHeader();
 
-            rawCommand[0] = 0x0E; // Start of frame (SOF) byte
-            rawCommand[1] = 0x00; // Protocol version
-
-            rawCommand[2] = static_cast<unsigned char>(this->sequenceId);
-            rawCommand[3] = static_cast<unsigned char>(this->sequenceId >> 8);
-
-            rawCommand[4] = static_cast<unsigned char>(this->protocolHandlerId);
+            auto rawCommand = std::vector<unsigned char>(header.size() + this->payload.size());
+            std::copy(header.begin(), header.end(), rawCommand.begin());
 
             if (!this->payload.empty()) {
-                std::copy(this->payload.begin(), this->payload.end(), rawCommand.begin() + 5);
+                std::copy(this->payload.begin(), this->payload.end(), rawCommand.begin() + header.size());
             }
 
             return rawCommand;
@@ -136,6 +132,9 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
          * This methods generates AVR commands from an AvrCommandFrame. The number of AvrCommands generated depends
          * on the size of the AvrCommandFrame and the passed maximumCommandPacketSize.
          *
+         * The frame is serialised directly into the AvrCommands - we don't construct the raw command frame in an
+         * intermediate buffer.
+         *
          * @param maximumCommandPacketSize
          *  The maximum size of an AVRCommand command packet. This is usually the REPORT_SIZE of the HID
          *  endpoint, minus a few bytes to account for other AVRCommand fields. The maximumCommandPacketSize is used to
@@ -145,32 +144,49 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
          *  A vector of sequenced AvrCommands, each containing a segment of the AvrCommandFrame.
          */
         [[nodiscard]] std::vector<AvrCommand> generateAvrCommands(std::size_t maximumCommandPacketSize) const {
-            auto rawCommandFrame = this->getRawCommandFrame();
+            const auto header = this->getRawCommandFrameHeader();
 
-            std::size_t commandFrameSize = rawCommandFrame.size();
-            auto commandsRequired = static_cast<std::size_t>(
-                std::ceil(static_cast<float>(commandFrameSize) / static_cast<float>(maximumCommandPacketSize))
-            );
+            const auto commandFrameSize = header.size() + this->payload.size();
+            const auto commandsRequired = (commandFrameSize + maximumCommandPacketSize - 1)
+                / maximumCommandPacketSize;
 
             std::vector<AvrCommand> avrCommands;
-            std::size_t copiedPacketSize = 0;
+            avrCommands.reserve(commandsRequired);
+
+            auto headerIt = header.begin();
+            auto payloadIt = this->payload.begin();
+
             for (std::size_t i = 0; i < commandsRequired; i++) {
                 // If we're on the last packet, the packet size will be what ever is left of the AvrCommandFrame
-                std::size_t commandPacketSize = ((i + 1) != commandsRequired) ? maximumCommandPacketSize
+                const auto commandPacketSize = ((i + 1) != commandsRequired) ? maximumCommandPacketSize
                     : (commandFrameSize - (maximumCommandPacketSize * i));
 
-                avrCommands.emplace_back(AvrCommand(
-                    commandsRequired,
-                    i + 1,
-                    std::vector<unsigned char>(
-                        rawCommandFrame.begin() + static_cast<std::int64_t>(copiedPacketSize),
-                        rawCommandFrame.begin() + static_cast<std::int64_t>(copiedPacketSize + commandPacketSize)
-                    )
-                ));
-                copiedPacketSize += commandPacketSize;
+                auto& avrCommand = avrCommands.emplace_back(commandsRequired, i + 1, commandPacketSize);
+
+                const auto headerBytes = std::min(
+                    static_cast<std::size_t>(std::distance(headerIt, header.end())),
+                    commandPacketSize
+                );
+                avrCommand.data.insert(avrCommand.data.end(), headerIt, headerIt + headerBytes);
+                headerIt += headerBytes;
+
+                const auto payloadBytes = static_cast<std::int64_t>(commandPacketSize - headerBytes);
+                avrCommand.data.insert(avrCommand.data.end(), payloadIt, payloadIt + payloadBytes);
+                payloadIt += payloadBytes;
             }
 
             return avrCommands;
         }
+
+    private:
+        [[nodiscard]] std::array<unsigned char, 5> getRawCommandFrameHeader() const {
+            return {
+                0x0E, // Start of frame (SOF) byte
+                0x00, // Protocol version
+                static_cast<unsigned char>(this->sequenceId),
+                static_cast<unsigned char>(this->sequenceId >> 8),
+                static_cast<unsigned char>(this->protocolHandlerId),
+            };
+        }
     };
 }
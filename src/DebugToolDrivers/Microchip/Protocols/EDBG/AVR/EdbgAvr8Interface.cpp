@@ -3,11 +3,13 @@
 #include <thread>
 #include <cassert>
 #include <cmath>
+#include <algorithm>
 
 #include "src/Services/PathService.hpp"
 #include "src/Services/StringService.hpp"
 #include "src/Logger/Logger.hpp"
 
+#include "RegisterReadPlanner.hpp"
 #include "Exceptions/Avr8CommandFailure.hpp"
 #include "src/TargetController/Exceptions/DeviceInitializationFailure.hpp"
 #include "src/Targets/Microchip/AVR/AVR8/Exceptions/DebugWirePhysicalInterfaceError.hpp"
@@ -79,6 +81,7 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
     using Targets::TargetMemoryType;
     using Targets::TargetMemoryBuffer;
     using Targets::TargetMemoryAddress;
+    using Targets::TargetMemoryAddressRange;
     using Targets::TargetMemorySize;
     using Targets::TargetRegister;
     using Targets::TargetRegisterDescriptor;
@@ -139,6 +142,37 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
         );
 
         this->setTargetParameters();
+
+        if (this->targetConfig.maximumMemoryAccessSize.has_value()) {
+            this->maximumMemoryAccessSizePerRequest = *(this->targetConfig.maximumMemoryAccessSize);
+        }
+
+        if (this->targetConfig.pipelineDebugToolCommands) {
+            this->enableCommandPipelining();
+        }
+    }
+
+    void EdbgAvr8Interface::enableCommandPipelining() {
+        try {
+            const auto packetCount = this->edbgInterface->queryPacketCount();
+            Logger::debug(
+                "CMSIS-DAP packet count: " + (packetCount.has_value() ? std::to_string(*packetCount) : "N/A")
+            );
+
+            if (!packetCount.has_value() || *packetCount < 2) {
+                Logger::warning("Command pipelining is not supported by the debug tool - commands will not be batched");
+                return;
+            }
+
+            this->edbgInterface->setMaximumPipelinedCommands(*packetCount);
+            Logger::info("Command pipelining enabled - batch size: " + std::to_string(*packetCount));
+
+        } catch (const Exception& exception) {
+            Logger::warning(
+                "Failed to query CMSIS-DAP packet count - commands will not be batched. Error: "
+                    + exception.getMessage()
+            );
+        }
     }
 
     void EdbgAvr8Interface::stop() {
@@ -247,6 +281,14 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
         if (!this->targetAttached) {
             this->attach();
         }
+
+        if (
+            this->targetConfig.probeMaximumMemoryAccessSize
+            && !this->maximumMemoryAccessSizePerRequest.has_value()
+            && !this->probedMaximumMemoryReadSize.has_value()
+        ) {
+            this->probeMaximumMemoryReadSize();
+        }
     }
 
     void EdbgAvr8Interface::deactivate() {
@@ -368,6 +410,34 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
         }
     }
 
+    void EdbgAvr8Interface::setSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) {
+        if (addresses.empty()) {
+            return;
+        }
+
+        const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+            SetSoftwareBreakpoints(addresses)
+        );
+
+        if (responseFrame.id == Avr8ResponseId::FAILED) {
+            throw Avr8CommandFailure("AVR8 Set software breakpoints command failed", responseFrame);
+        }
+    }
+
+    void EdbgAvr8Interface::clearSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) {
+        if (addresses.empty()) {
+            return;
+        }
+
+        const auto responseFrame = this->edbgInterface->sendAvrCommandFrameAndWaitForResponseFrame(
+            ClearSoftwareBreakpoints(addresses)
+        );
+
+        if (responseFrame.id == Avr8ResponseId::FAILED) {
+            throw Avr8CommandFailure("AVR8 Clear software breakpoints command failed", responseFrame);
+        }
+    }
+
     void EdbgAvr8Interface::setHardwareBreakpoint(TargetMemoryAddress address) {
         static const auto getAvailableBreakpointNumbers = [this] () {
             auto breakpointNumbers = std::set<std::uint8_t>({1, 2, 3});
@@ -439,30 +509,15 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
          * means we will be frequently loading over 100 register values in a single instance.
          *
          * For the above reason, we do not read each register value individually. That would take far too long if we
-         * have over 100 registers to read. Instead, we group the register descriptors into collections by register
-         * type, and resolve the address range for each collection. We then perform a single read operation for
-         * each collection and hold the memory buffer in a random access container (std::vector). Finally, we extract
-         * the data for each register descriptor, from the memory buffer, and construct the relevant TargetRegister
-         * object.
-         *
-         * TODO: We should be grouping the register descriptors by memory type, as opposed to register type. This
-         *       isn't much of a problem ATM, as currently, we only work with registers that are stored in the data
-         *       address space or the register file. This will need to be addressed before we can work with any other
-         *       registers stored elsewhere.
+         * have over 100 registers to read. Instead, we group the register descriptors by the memory type in which
+         * the registers reside, and plan a set of address ranges to read for each memory type (see
+         * EdbgAvr8Interface::planRegisterReadRanges()). We then perform a single read operation for each range and
+         * extract the data for each register descriptor, from the memory buffer, to construct the relevant
+         * TargetRegister object.
          */
         auto output = TargetRegisters();
 
-        // Group descriptors by type and resolve the address range for each type
-        auto descriptorIdsByType = std::map<TargetRegisterType, std::set<TargetRegisterDescriptorId>>();
-
-        /*
-         * An address range is just an std::pair of addresses - the first being the start address, the second being
-         * the end address.
-         *
-         * TODO: Can't we just use the TargetMemoryAddressRange struct here? Review
-         */
-        using AddressRange = std::pair<TargetMemoryAddress, TargetMemoryAddress>;
-        auto addressRangeByType = std::map<TargetRegisterType, AddressRange>();
+        auto descriptorsByMemoryType = std::map<Avr8MemoryType, std::vector<const TargetRegisterDescriptor*>>();
 
         for (const auto& descriptorId : descriptorIds) {
             const auto descriptorIt = this->targetRegisterDescriptorsById.find(descriptorId);
@@ -478,45 +533,16 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
                 continue;
             }
 
-            descriptorIdsByType[descriptor.type].insert(descriptor.id);
-
-            const auto startAddress = descriptor.startAddress.value();
-            const auto endAddress = startAddress + (descriptor.size - 1);
-
-            const auto addressRangeIt = addressRangeByType.find(descriptor.type);
-
-            if (addressRangeIt == addressRangeByType.end()) {
-                addressRangeByType[descriptor.type] = AddressRange(startAddress, endAddress);
-
-            } else {
-                auto& addressRange = addressRangeIt->second;
-
-                if (startAddress < addressRange.first) {
-                    addressRange.first = startAddress;
-                }
-
-                if (endAddress > addressRange.second) {
-                    addressRange.second = endAddress;
-                }
-            }
-        }
-
-        /*
-         * Now that we have our address ranges and grouped descriptors, we can perform a single read call for each
-         * register type.
-         */
-        for (const auto&[registerType, descriptorIds] : descriptorIdsByType) {
-            const auto& addressRange = addressRangeByType[registerType];
-            const auto startAddress = addressRange.first;
-            const auto endAddress = addressRange.second;
-            const auto readSize = (endAddress - startAddress) + 1;
-
-            const auto memoryType = (registerType != TargetRegisterType::GENERAL_PURPOSE_REGISTER)
+            const auto memoryType = (descriptor.type != TargetRegisterType::GENERAL_PURPOSE_REGISTER)
                 ? Avr8MemoryType::SRAM
                 : (this->configVariant == Avr8ConfigVariant::XMEGA || this->configVariant == Avr8ConfigVariant::UPDI
                     ? Avr8MemoryType::REGISTER_FILE
                     : Avr8MemoryType::SRAM);
 
+            descriptorsByMemoryType[memoryType].push_back(&descriptor);
+        }
+
+        for (auto& [memoryType, descriptors] : descriptorsByMemoryType) {
             /*
              * When reading the entire range, we must avoid any attempts to access the OCD data register (OCDDR), as
              * the debug tool will reject the command and respond with a 0x36 error code (invalid address error).
@@ -546,49 +572,112 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
                 );
             }
 
-            const auto flatMemoryData = this->readMemory(
-                memoryType,
-                startAddress,
-                readSize,
-                excludedAddresses
+            std::sort(
+                descriptors.begin(),
+                descriptors.end(),
+                [] (const TargetRegisterDescriptor* descriptorA, const TargetRegisterDescriptor* descriptorB) {
+                    return descriptorA->startAddress.value() < descriptorB->startAddress.value();
+                }
             );
 
-            if (flatMemoryData.size() != readSize) {
-                throw Exception(
-                    "Failed to read memory within register type address range (" + std::to_string(startAddress)
-                        + " - " + std::to_string(endAddress) + "). Expected " + std::to_string(readSize)
-                        + " bytes, got " + std::to_string(flatMemoryData.size())
-                );
-            }
-
-            // Construct our TargetRegister objects directly from the flat memory buffer
-            for (const auto descriptorId : descriptorIds) {
-                const auto descriptorIt = this->targetRegisterDescriptorsById.find(descriptorId);
-                const auto& descriptor = descriptorIt->second;
+            auto descriptorIt = descriptors.begin();
 
-                /*
-                 * Multibyte AVR8 registers are stored in LSB form.
-                 *
-                 * This is why we use reverse iterators when extracting our data from flatMemoryData. Doing so allows
-                 * us to extract the data in MSB form (as is expected for all register values held in TargetRegister
-                 * objects).
-                 */
-                const auto bufferStartIt = flatMemoryData.rend() - (descriptor.startAddress.value() - startAddress)
-                    - descriptor.size;
+            for (const auto& addressRange : this->planRegisterReadRanges(memoryType, descriptors)) {
+                const auto startAddress = addressRange.startAddress;
+                const auto endAddress = addressRange.endAddress;
+                const auto readSize = (endAddress - startAddress) + 1;
 
-                output.emplace_back(
-                    TargetRegister(
-                        descriptor.id,
-                        TargetMemoryBuffer(bufferStartIt, bufferStartIt + descriptor.size)
-                    )
+                const auto flatMemoryData = this->readMemory(
+                    memoryType,
+                    startAddress,
+                    readSize,
+                    excludedAddresses
                 );
+
+                if (flatMemoryData.size() != readSize) {
+                    throw Exception(
+                        "Failed to read memory within register address range (" + std::to_string(startAddress)
+                            + " - " + std::to_string(endAddress) + "). Expected " + std::to_string(readSize)
+                            + " bytes, got " + std::to_string(flatMemoryData.size())
+                    );
+                }
+
+                // Construct our TargetRegister objects directly from the flat memory buffer
+                for (
+                    ;
+                    descriptorIt != descriptors.end() && (*descriptorIt)->startAddress.value() <= endAddress;
+                    ++descriptorIt
+                ) {
+                    const auto& descriptor = **descriptorIt;
+
+                    /*
+                     * Multibyte AVR8 registers are stored in LSB form.
+                     *
+                     * This is why we use reverse iterators when extracting our data from flatMemoryData. Doing so
+                     * allows us to extract the data in MSB form (as is expected for all register values held in
+                     * TargetRegister objects).
+                     */
+                    const auto bufferStartIt = flatMemoryData.rend() - (descriptor.startAddress.value() - startAddress)
+                        - descriptor.size;
+
+                    output.emplace_back(
+                        TargetRegister(
+                            descriptor.id,
+                            TargetMemoryBuffer(bufferStartIt, bufferStartIt + descriptor.size)
+                        )
+                    );
+                }
             }
         }
 
         return output;
     }
 
+    std::vector<TargetMemoryAddressRange> EdbgAvr8Interface::planRegisterReadRanges(
+        Avr8MemoryType memoryType,
+        const std::vector<const TargetRegisterDescriptor*>& sortedDescriptors
+    ) {
+        /*
+         * Every read command costs at least one round trip to the debug tool. Reading the bytes in a gap between two
+         * registers only costs more when it results in more HID reports being transferred. So we bridge any gap
+         * that is smaller than the payload of a single HID report, and split the range at any gap that is larger.
+         *
+         * The -30 is to accommodate for the bytes in the response that are not part of the payload (see
+         * EdbgAvr8Interface::maximumMemoryAccessSize()).
+         */
+        const auto reportPayloadSize = static_cast<TargetMemorySize>(
+            this->edbgInterface->getUsbHidInputReportSize() - 30
+        );
+        const auto maximumGapSize = std::min(
+            reportPayloadSize,
+            this->maximumMemoryAccessSize(memoryType, true).value_or(reportPayloadSize)
+        );
+
+        return RegisterReadPlanner::planReadRanges(sortedDescriptors, maximumGapSize);
+    }
+
     void EdbgAvr8Interface::writeRegisters(const Targets::TargetRegisters& registers) {
+        /*
+         * As with EdbgAvr8Interface::readRegisters(), we avoid issuing a separate write command for each register.
+         * GDB writes all GP registers, SREG and SP in a single 'G' packet, and Insight can write many registers at
+         * once.
+         *
+         * We group the register bytes by memory type, and then coalesce them into contiguous address runs. Each run is
+         * written via a single EdbgAvr8Interface::writeMemory() call.
+         *
+         * Gaps between runs are only bridged when they fall between general purpose registers, in which case we
+         * perform a read-modify-write of the whole span. The EDBG protocol provides no masked write command, and we
+         * cannot write back the values of other registers, as doing so can have side effects (for example, clearing
+         * interrupt flags).
+         */
+        struct RegisterByte
+        {
+            unsigned char value;
+            bool generalPurpose;
+        };
+
+        auto bytesByAddressByMemoryType = std::map<Avr8MemoryType, std::map<TargetMemoryAddress, RegisterByte>>();
+
         for (const auto& reg : registers) {
             const auto& registerDescriptorIt = this->targetRegisterDescriptorsById.find(reg.descriptorId);
             assert(registerDescriptorIt != this->targetRegisterDescriptorsById.end());
@@ -614,20 +703,63 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
                 std::reverse(registerValue.begin(), registerValue.end());
             }
 
+            const auto generalPurpose = registerDescriptor.type == TargetRegisterType::GENERAL_PURPOSE_REGISTER;
+
             auto memoryType = Avr8MemoryType::SRAM;
             if (
-                registerDescriptor.type == TargetRegisterType::GENERAL_PURPOSE_REGISTER
+                generalPurpose
                 && (this->configVariant == Avr8ConfigVariant::XMEGA || this->configVariant == Avr8ConfigVariant::UPDI)
             ) {
                 memoryType = Avr8MemoryType::REGISTER_FILE;
             }
 
-            // TODO: This can be inefficient when updating many registers, maybe do something a little smarter here.
-            this->writeMemory(
-                memoryType,
-                registerDescriptor.startAddress.value(),
-                registerValue
-            );
+            auto& bytesByAddress = bytesByAddressByMemoryType[memoryType];
+            const auto startAddress = registerDescriptor.startAddress.value();
+
+            for (auto i = std::size_t{0}; i < registerValue.size(); ++i) {
+                bytesByAddress[static_cast<TargetMemoryAddress>(startAddress + i)] = RegisterByte{
+                    .value = registerValue[i],
+                    .generalPurpose = generalPurpose,
+                };
+            }
+        }
+
+        for (const auto& [memoryType, bytesByAddress] : bytesByAddressByMemoryType) {
+            auto runStartIt = bytesByAddress.begin();
+
+            while (runStartIt != bytesByAddress.end()) {
+                auto runEndIt = runStartIt;
+                auto bridged = false;
+
+                for (auto nextIt = std::next(runEndIt); nextIt != bytesByAddress.end(); ++nextIt) {
+                    if (nextIt->first == runEndIt->first + 1) {
+                        runEndIt = nextIt;
+                        continue;
+                    }
+
+                    if (runEndIt->second.generalPurpose && nextIt->second.generalPurpose) {
+                        runEndIt = nextIt;
+                        bridged = true;
+                        continue;
+                    }
+
+                    break;
+                }
+
+                const auto startAddress = runStartIt->first;
+                const auto bytes = static_cast<TargetMemorySize>(runEndIt->first - startAddress + 1);
+
+                auto buffer = bridged
+                    ? this->readMemory(memoryType, startAddress, bytes)
+                    : TargetMemoryBuffer(bytes, 0x00);
+
+                for (auto byteIt = runStartIt; byteIt != std::next(runEndIt); ++byteIt) {
+                    buffer[byteIt->first - startAddress] = byteIt->second.value;
+                }
+
+                this->writeMemory(memoryType, startAddress, buffer);
+                runStartIt = std::next(runEndIt);
+            }
         }
     }
 
@@ -1677,7 +1809,153 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
         return bytes;
     }
 
-    std::optional<Targets::TargetMemorySize> EdbgAvr8Interface::maximumMemoryAccessSize(Avr8MemoryType memoryType) {
+    void EdbgAvr8Interface::probeMaximumMemoryReadSize() {
+        if (
+            !this->targetParameters.ramStartAddress.has_value()
+            || !this->targetParameters.ramSize.has_value()
+        ) {
+            return;
+        }
+
+        try {
+            if (this->getTargetState() != TargetState::STOPPED) {
+                Logger::debug("Skipping memory read size probe - target is not stopped");
+                return;
+            }
+
+            const auto defaultSize = this->maximumMemoryAccessSize(Avr8MemoryType::SRAM).value();
+
+            /*
+             * We probe multiples of the default size, up to four times the default size. Each multiple results in
+             * at least one more HID report per request, which is where the EDBG tools are known to misbehave.
+             */
+            static constexpr auto MAXIMUM_SIZE_MULTIPLIER = 4;
+            const auto probeRegionSize = static_cast<TargetMemorySize>(defaultSize * MAXIMUM_SIZE_MULTIPLIER);
+
+            /*
+             * The only way we can tell if the debug tool has serviced a read correctly is by comparing the data with
+             * what we read using the default maximum access size. If the tool duplicates or reorders the HID reports
+             * in a response, the data will only differ if the reports carried different data. Uninitialised SRAM is
+             * often uniform (all 0x00 or 0xFF), so we search the target's RAM for regions in which every report-sized
+             * span of data differs from the span preceding it, and we verify each candidate size against all of them.
+             */
+            static constexpr auto MAXIMUM_REGIONS_SEARCHED = 8;
+            static constexpr auto REQUIRED_REGION_COUNT = 2;
+
+            // The AVR_RSP report header consists of 4 bytes (see AvrResponse)
+            const auto reportPayloadSize = static_cast<TargetMemorySize>(
+                this->edbgInterface->getUsbHidInputReportSize() - 4
+            );
+
+            const auto ramEndAddress = static_cast<TargetMemoryAddress>(
+                *(this->targetParameters.ramStartAddress) + *(this->targetParameters.ramSize)
+            );
+
+            auto referenceDataByStartAddress = std::map<TargetMemoryAddress, TargetMemoryBuffer>();
+            auto regionStartAddress = static_cast<TargetMemoryAddress>(*(this->targetParameters.ramStartAddress));
+
+            for (
+                auto regionsSearched = 0;
+                regionStartAddress + probeRegionSize <= ramEndAddress
+                    && regionsSearched < MAXIMUM_REGIONS_SEARCHED
+                    && referenceDataByStartAddress.size() < REQUIRED_REGION_COUNT;
+                regionStartAddress += probeRegionSize, ++regionsSearched
+            ) {
+                // Ground truth, read using the default maximum access size
+                auto referenceData = this->readMemory(Avr8MemoryType::SRAM, regionStartAddress, probeRegionSize);
+
+                if (EdbgAvr8Interface::isValidProbeReference(referenceData, reportPayloadSize)) {
+                    referenceDataByStartAddress.emplace(regionStartAddress, std::move(referenceData));
+                }
+            }
+
+            if (referenceDataByStartAddress.empty()) {
+                Logger::debug(
+                    "Skipping memory read size probe - no region of RAM holds data that would reveal incorrect reads"
+                );
+                return;
+            }
+
+            auto largestValidSize = defaultSize;
+            for (auto multiplier = 2; multiplier <= MAXIMUM_SIZE_MULTIPLIER; ++multiplier) {
+                const auto candidateSize = static_cast<TargetMemorySize>(defaultSize * multiplier);
+                this->probedMaximumMemoryReadSize = candidateSize;
+
+                const auto candidateValid = std::all_of(
+                    referenceDataByStartAddress.begin(),
+                    referenceDataByStartAddress.end(),
+                    [this, candidateSize] (const auto& referenceDataPair) {
+                        const auto& [startAddress, referenceData] = referenceDataPair;
+
+                        try {
+                            const auto data = this->readMemory(Avr8MemoryType::SRAM, startAddress, candidateSize);
+
+                            return data.size() == candidateSize
+                                && std::equal(data.begin(), data.end(), referenceData.begin());
+
+                        } catch (const Exception& exception) {
+                            Logger::debug(
+                                "Memory read of " + std::to_string(candidateSize) + " bytes failed during probe - "
+                                    + exception.getMessage()
+                            );
+                            return false;
+                        }
+                    }
+                );
+
+                if (!candidateValid) {
+                    break;
+                }
+
+                largestValidSize = candidateSize;
+            }
+
+            this->probedMaximumMemoryReadSize = largestValidSize;
+
+            Logger::info(
+                "Maximum memory read size for debug tool: " + std::to_string(largestValidSize) + " bytes (default: "
+                    + std::to_string(defaultSize) + " bytes)"
+            );
+
+        } catch (const Exception& exception) {
+            this->probedMaximumMemoryReadSize = std::nullopt;
+            Logger::debug("Memory read size probe failed - " + exception.getMessage());
+        }
+    }
+
+    bool EdbgAvr8Interface::isValidProbeReference(
+        const TargetMemoryBuffer& data,
+        TargetMemorySize reportPayloadSize
+    ) {
+        /*
+         * We don't know exactly where each report boundary falls within the data, as the response frame header
+         * occupies the beginning of the first report. So we check every offset: there must be no run of
+         * reportPayloadSize bytes that is identical to the reportPayloadSize bytes preceding it.
+         */
+        if (data.size() < static_cast<std::size_t>(reportPayloadSize) * 2) {
+            return false;
+        }
+
+        auto matchingRunLength = TargetMemorySize{0};
+
+        for (auto i = static_cast<std::size_t>(reportPayloadSize); i < data.size(); ++i) {
+            if (data[i] != data[i - reportPayloadSize]) {
+                matchingRunLength = 0;
+                continue;
+            }
+
+            if (++matchingRunLength >= reportPayloadSize) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::optional<Targets::TargetMemorySize> EdbgAvr8Interface::maximumMemoryAccessSize(
+        Avr8MemoryType memoryType,
+        bool read
+    ) {
         if (
             memoryType == Avr8MemoryType::FLASH_PAGE
             || memoryType == Avr8MemoryType::APPL_FLASH
@@ -1701,6 +1979,10 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
             return this->maximumMemoryAccessSizePerRequest;
         }
 
+        if (read && this->probedMaximumMemoryReadSize.has_value()) {
+            return this->probedMaximumMemoryReadSize;
+        }
+
         /*
          * EDBG AVR8 debug tools behave in a really weird way when receiving or responding with more than two packets
          * for a single memory access command. The data they read/write in this case appears to be wrong.
@@ -1800,7 +2082,7 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
             }
         }
 
-        const auto maximumReadSize = this->maximumMemoryAccessSize(type);
+        const auto maximumReadSize = this->maximumMemoryAccessSize(type, true);
         if (maximumReadSize.has_value() && bytes > *maximumReadSize) {
             auto output = Targets::TargetMemoryBuffer();
             output.reserve(bytes);
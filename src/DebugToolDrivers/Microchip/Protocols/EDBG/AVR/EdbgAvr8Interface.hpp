@@ -5,6 +5,9 @@
 #include <thread>
 #include <optional>
 #include <cassert>
+#include <map>
+#include <vector>
+#include <string>
 
 #include "src/DebugToolDrivers/TargetInterfaces/Microchip/AVR/AVR8/Avr8DebugInterface.hpp"
 #include "src/DebugToolDrivers/Microchip/Protocols/EDBG/EdbgInterface.hpp"
@@ -179,6 +182,22 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
          */
         void clearSoftwareBreakpoint(Targets::TargetMemoryAddress address) override;
 
+        /**
+         * Issues a single "Software Breakpoint Set" command to the debug tool, setting software breakpoints at all of
+         * the given byte addresses.
+         *
+         * @param addresses
+         */
+        void setSoftwareBreakpoints(const std::vector<Targets::TargetMemoryAddress>& addresses) override;
+
+        /**
+         * Issues a single "Software Breakpoint Clear" command to the debug tool, clearing any software breakpoints at
+         * the given byte addresses.
+         *
+         * @param addresses
+         */
+        void clearSoftwareBreakpoints(const std::vector<Targets::TargetMemoryAddress>& addresses) override;
+
         /**
          * Issues the "Hardware Breakpoint Set" command to the debug tool, setting a hardware breakpoint at the given
          * byte address.
@@ -340,6 +359,14 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
          */
         std::optional<Targets::TargetMemorySize> maximumMemoryAccessSizePerRequest;
 
+        /**
+         * The largest read size that the debug tool was found to service correctly, during the probe performed upon
+         * activation. See EdbgAvr8Interface::probeMaximumMemoryReadSize().
+         *
+         * This only applies to memory reads, and only when no maximumMemoryAccessSizePerRequest has been set.
+         */
+        std::optional<Targets::TargetMemorySize> probedMaximumMemoryReadSize;
+
         bool reactivateJtagTargetPostProgrammingMode = false;
 
         /**
@@ -538,15 +565,74 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
          */
         Targets::TargetMemorySize alignMemoryBytes(Avr8MemoryType memoryType, Targets::TargetMemorySize bytes);
 
+        /**
+         * Plans the address ranges to read, in order to obtain the values of the given registers, all of which must
+         * reside in the given memory type.
+         *
+         * Neighbouring registers are merged into a single range, unless the gap between them is large enough to make
+         * a separate read cheaper than reading the gap. See RegisterReadPlanner::planReadRanges().
+         *
+         * @param memoryType
+         * @param sortedDescriptors
+         *  The register descriptors, sorted by start address.
+         *
+         * @return
+         *  The address ranges to read, in ascending order.
+         */
+        std::vector<Targets::TargetMemoryAddressRange> planRegisterReadRanges(
+            Avr8MemoryType memoryType,
+            const std::vector<const Targets::TargetRegisterDescriptor*>& sortedDescriptors
+        );
+
         /**
          * Checks if a maximum memory access size is imposed for a given Avr8MemoryType.
          *
          * @param memoryType
          *  The imposed maximum size, or std::nullopt if a maximum isn't required.
          *
+         * @param read
+         *  Whether the access is a read. The probed maximum read size (if any) will only be applied to reads.
+         *
          * @return
          */
-        std::optional<Targets::TargetMemorySize> maximumMemoryAccessSize(Avr8MemoryType memoryType);
+        std::optional<Targets::TargetMemorySize> maximumMemoryAccessSize(Avr8MemoryType memoryType, bool read = false);
+
+        /**
+         * Enables command pipelining on the EDBG interface, if the debug tool reports that it can buffer more than
+         * one command packet. See Avr8TargetConfig::pipelineDebugToolCommands.
+         */
+        void enableCommandPipelining();
+
+        /**
+         * Determines the largest memory read size that the debug tool can service correctly, by reading regions of
+         * the target's RAM with the default (conservative) maximum access size, and then reading the same regions
+         * with progressively larger requests. The largest request size that yields identical data for every region is
+         * adopted for all subsequent reads.
+         *
+         * Only regions that pass EdbgAvr8Interface::isValidProbeReference() are used. If there are none, no probing
+         * takes place.
+         *
+         * The probe only issues read commands, and it requires the target to be stopped. Any failure will result in
+         * the default maximum access size being retained.
+         */
+        void probeMaximumMemoryReadSize();
+
+        /**
+         * Checks if the given data can reveal duplicated or reordered HID reports in a memory read response. That is,
+         * if no report-sized span of the data is identical to the span preceding it. Uniform data never passes.
+         *
+         * @param data
+         *  Data read with the default maximum access size.
+         *
+         * @param reportPayloadSize
+         *  The number of bytes of response data carried by each HID report.
+         *
+         * @return
+         */
+        static bool isValidProbeReference(
+            const Targets::TargetMemoryBuffer& data,
+            Targets::TargetMemorySize reportPayloadSize
+        );
 
         /**
          * Reads memory on the target.
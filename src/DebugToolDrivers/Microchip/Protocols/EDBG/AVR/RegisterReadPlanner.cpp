@@ -0,0 +1,31 @@
+#include "RegisterReadPlanner.hpp"
+
+#include <algorithm>
+
+namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemoryAddressRange;
+
+    std::vector<TargetMemoryAddressRange> RegisterReadPlanner::planReadRanges(
+        const std::vector<const Targets::TargetRegisterDescriptor*>& sortedDescriptors,
+        Targets::TargetMemorySize maximumGapSize
+    ) {
+        auto output = std::vector<TargetMemoryAddressRange>();
+
+        for (const auto* descriptor : sortedDescriptors) {
+            const auto startAddress = descriptor->startAddress.value();
+            const auto endAddress = static_cast<TargetMemoryAddress>(startAddress + descriptor->size - 1);
+
+            if (!output.empty() && startAddress <= output.back().endAddress + maximumGapSize + 1) {
+                auto& addressRange = output.back();
+                addressRange.endAddress = std::max(addressRange.endAddress, endAddress);
+                continue;
+            }
+
+            output.emplace_back(startAddress, endAddress);
+        }
+
+        return output;
+    }
+}
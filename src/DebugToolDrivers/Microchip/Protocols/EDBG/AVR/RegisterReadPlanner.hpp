@@ -0,0 +1,38 @@
+#pragma once
+
+#include <vector>
+
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/TargetRegister.hpp"
+
+namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
+{
+    /**
+     * Plans the address ranges to read, in order to obtain the values of a set of registers.
+     *
+     * See EdbgAvr8Interface::readRegisters() for more.
+     */
+    class RegisterReadPlanner
+    {
+    public:
+        /**
+         * Merges neighbouring registers into a single range, unless the gap between them exceeds maximumGapSize.
+         *
+         * Overlapping registers (such as a 16-bit register and the two 8-bit registers that make it up) are merged
+         * into the same range, regardless of maximumGapSize.
+         *
+         * @param sortedDescriptors
+         *  The register descriptors, sorted by start address. All must have a start address.
+         *
+         * @param maximumGapSize
+         *  The number of unused bytes that may be read between two registers, before the range is split.
+         *
+         * @return
+         *  The address ranges to read, in ascending order.
+         */
+        static std::vector<Targets::TargetMemoryAddressRange> planReadRanges(
+            const std::vector<const Targets::TargetRegisterDescriptor*>& sortedDescriptors,
+            Targets::TargetMemorySize maximumGapSize
+        );
+    };
+}
@@ -1,5 +1,7 @@
 #include "AvrResponseFrame.hpp"
 
+#include <array>
+
 #include "src/Exceptions/Exception.hpp"
 
 namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
@@ -7,33 +9,42 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
     using namespace Exceptions;
 
     void AvrResponseFrame::initFromAvrResponses(const std::vector<AvrResponse>& avrResponses) {
-        // Build a raw frame buffer from the AvrResponse objects and just call initFromRawFrame()
-        auto rawFrame = std::vector<unsigned char>();
-
+        /*
+         * We parse the frame header directly from the response packets, and copy the remaining bytes straight into
+         * the payload. This avoids assembling the raw frame in a separate buffer.
+         */
+        auto frameSize = std::size_t{0};
         for (const auto& avrResponse : avrResponses) {
-            rawFrame.insert(rawFrame.end(), avrResponse.responsePacket.begin(), avrResponse.responsePacket.end());
+            frameSize += avrResponse.getResponsePacket().size();
         }
 
-        return this->initFromRawFrame(rawFrame);
-    }
+        // The frame header consists of the SOF byte, the sequence ID (two bytes) and the protocol handler ID
+        auto header = std::array<unsigned char, 4>();
 
-    void AvrResponseFrame::initFromRawFrame(const std::vector<unsigned char>& rawFrame) {
-        if (rawFrame.size() < 4) {
-            /*
-             * All AVR response frames must consist of at least four bytes (SOF, sequence ID (two bytes) and
-             * a protocol handler ID).
-             */
+        if (frameSize < header.size()) {
             throw Exception("Failed to construct AvrResponseFrame - unexpected end to raw frame");
         }
 
-        if (rawFrame[0] != 0x0E) {
+        this->payload.clear();
+        this->payload.reserve(frameSize - header.size());
+
+        auto headerSize = std::size_t{0};
+        for (const auto& avrResponse : avrResponses) {
+            const auto responsePacket = avrResponse.getResponsePacket();
+            const auto headerBytes = std::min(header.size() - headerSize, responsePacket.size());
+
+            std::copy_n(responsePacket.begin(), headerBytes, header.begin() + headerSize);
+            headerSize += headerBytes;
+
+            this->payload.insert(this->payload.end(), responsePacket.begin() + headerBytes, responsePacket.end());
+        }
+
+        if (header[0] != 0x0E) {
             // Invalid SOF byte value
             throw Exception("Failed to construct AvrResponseFrame - unexpected SOF byte value in raw frame");
         }
 
-        this->sequenceId = static_cast<std::uint16_t>((rawFrame[2] << 8) + rawFrame[1]);
-        this->protocolHandlerId = static_cast<ProtocolHandlerId>(rawFrame[3]);
-
-        this->payload.insert(payload.begin(), rawFrame.begin() + 4, rawFrame.end());
+        this->sequenceId = static_cast<std::uint16_t>((header[2] << 8) + header[1]);
+        this->protocolHandlerId = static_cast<ProtocolHandlerId>(header[3]);
     }
 }
@@ -45,8 +45,5 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg::Avr
          * @param avrResponses
          */
         void initFromAvrResponses(const std::vector<AvrResponse>& avrResponses);
-
-    private:
-        virtual void initFromRawFrame(const std::vector<unsigned char>& rawFrame);
     };
 }
@@ -15,19 +15,15 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg
     ::DebugToolDrivers::Protocols::CmsisDap::Response EdbgInterface::sendAvrCommandsAndWaitForResponse(
         const std::vector<Avr::AvrCommand>& avrCommands
     ) {
-        for (const auto& avrCommand : avrCommands) {
-            // Send command to device
-            auto response = this->sendCommandAndWaitForResponse(avrCommand);
-
-            if (&avrCommand == &avrCommands.back()) {
-                return response;
-            }
+        if (avrCommands.empty()) {
+            // This should never happen
+            throw DeviceCommunicationFailure(
+                "Cannot send AVR command frame - failed to generate CMSIS-DAP Vendor (AVR) commands"
+            );
         }
 
-        // This should never happen
-        throw DeviceCommunicationFailure(
-            "Cannot send AVR command frame - failed to generate CMSIS-DAP Vendor (AVR) commands"
-        );
+        // The response to the last fragment will acknowledge receipt of the whole AvrCommandFrame
+        return this->sendCommandsAndWaitForResponses(avrCommands).back();
     }
 
     std::optional<Microchip::Protocols::Edbg::Avr::AvrEvent> EdbgInterface::requestAvrEvent() {
@@ -50,28 +46,65 @@ namespace DebugToolDrivers::Microchip::Protocols::Edbg
         responses.push_back(avrResponse);
         const auto fragmentCount = avrResponse.fragmentCount;
 
-        while (responses.size() < fragmentCount) {
-            // There are more response packets
-            auto avrResponse = this->sendCommandAndWaitForResponse(responseCommand);
+        if (this->getMaximumPipelinedCommands() < 2) {
+            while (responses.size() < fragmentCount) {
+                // There are more response packets
+                auto avrResponse = this->sendCommandAndWaitForResponse(responseCommand);
+
+                if (avrResponse.fragmentCount != fragmentCount) {
+                    throw DeviceCommunicationFailure(
+                        "Failed to fetch AvrResponse objects - invalid fragment count returned."
+                    );
+                }
+
+                if (avrResponse.fragmentCount == 0 && avrResponse.fragmentNumber == 0) {
+                    throw DeviceCommunicationFailure(
+                        "Failed to fetch AvrResponse objects - unexpected empty response"
+                    );
+                }
+
+                if (avrResponse.fragmentNumber == 0) {
+                    // End of response data ( &this packet can be ignored)
+                    break;
+                }
+
+                responses.push_back(avrResponse);
+            }
+
+            return responses;
+        }
+
+        if (fragmentCount <= 1) {
+            return responses;
+        }
+
+        /*
+         * With pipelining enabled, we request all of the remaining fragments at once, saving a round trip per
+         * fragment. We know how many remain from the fragment count in the first response.
+         */
+        const auto remainingResponses = this->sendCommandsAndWaitForResponses(
+            std::vector<AvrResponseCommand>(fragmentCount - 1, responseCommand)
+        );
 
-            if (avrResponse.fragmentCount != fragmentCount) {
+        for (const auto& remainingResponse : remainingResponses) {
+            if (remainingResponse.fragmentCount != fragmentCount) {
                 throw DeviceCommunicationFailure(
                     "Failed to fetch AvrResponse objects - invalid fragment count returned."
                 );
             }
 
-            if (avrResponse.fragmentCount == 0 && avrResponse.fragmentNumber == 0) {
+            if (remainingResponse.fragmentCount == 0 && remainingResponse.fragmentNumber == 0) {
                 throw DeviceCommunicationFailure(
                     "Failed to fetch AvrResponse objects - unexpected empty response"
                 );
             }
 
-            if (avrResponse.fragmentNumber == 0) {
+            if (remainingResponse.fragmentNumber == 0) {
                 // End of response data ( &this packet can be ignored)
                 break;
             }
 
-            responses.push_back(avrResponse);
+            responses.push_back(remainingResponse);
         }
 
         return responses;
@@ -3,6 +3,7 @@
 #include <memory>
 #include <optional>
 #include <vector>
+#include <string>
 
 #include "src/DebugToolDrivers/Protocols/CMSIS-DAP/CmsisDapInterface.hpp"
 
@@ -76,7 +77,17 @@ class EdbgInterface: public ::DebugToolDrivers::Protocols::CmsisDap::CmsisDapInt
                 );
             }
 
-            return typename CommandFrameType::ExpectedResponseFrameType(this->requestAvrResponses());
+            auto responseFrame = typename CommandFrameType::ExpectedResponseFrameType(this->requestAvrResponses());
+
+            if (responseFrame.sequenceId != avrCommandFrame.sequenceId) {
+                // The response frame must carry the sequence ID of the command frame it responds to
+                throw Exceptions::DeviceCommunicationFailure(
+                    "Unexpected AvrResponseFrame sequence ID (" + std::to_string(responseFrame.sequenceId)
+                        + ") - expected " + std::to_string(avrCommandFrame.sequenceId)
+                );
+            }
+
+            return responseFrame;
         }
 
         virtual std::optional<Avr::AvrEvent> requestAvrEvent();
@@ -8,7 +8,9 @@ namespace DebugToolDrivers::Protocols::CmsisDap
 
     CmsisDapInterface::CmsisDapInterface(Usb::HidInterface&& usbHidInterface)
         : usbHidInterface(std::move(usbHidInterface))
-    {}
+    {
+        this->commandBuffer.reserve(this->usbHidInterface.inputReportSize);
+    }
 
     void CmsisDapInterface::sendCommand(const Command& cmsisDapCommand) {
         if (this->commandDelay.count() > 0) {
@@ -23,6 +25,34 @@ namespace DebugToolDrivers::Protocols::CmsisDap
             this->lastCommandSentTimeStamp = now;
         }
 
-        this->getUsbHidInterface().write(cmsisDapCommand.rawCommand());
+        this->writeCommand(cmsisDapCommand);
+    }
+
+    void CmsisDapInterface::writeCommand(const Command& cmsisDapCommand) {
+        cmsisDapCommand.serialise(this->commandBuffer);
+
+        // Pad the command to the report size here, so that the HID interface doesn't have to copy it
+        if (this->commandBuffer.size() < this->usbHidInterface.inputReportSize) {
+            this->commandBuffer.resize(this->usbHidInterface.inputReportSize, 0x00);
+        }
+
+        this->usbHidInterface.write(this->commandBuffer);
+    }
+
+    std::optional<std::uint8_t> CmsisDapInterface::queryPacketCount() {
+        static constexpr auto DAP_INFO_COMMAND_ID = static_cast<unsigned char>(0x00);
+        static constexpr auto PACKET_COUNT_INFO_ID = static_cast<unsigned char>(0xFF);
+
+        auto dapInfoCommand = Command(DAP_INFO_COMMAND_ID);
+        dapInfoCommand.data = {PACKET_COUNT_INFO_ID};
+
+        const auto response = this->sendCommandAndWaitForResponse(dapInfoCommand);
+
+        // The first byte of the response data holds the length of the info value, which should be one byte
+        if (response.data.size() < 2 || response.data[0] != 1) {
+            return std::nullopt;
+        }
+
+        return response.data[1];
     }
 }
@@ -2,7 +2,10 @@
 
 #include <memory>
 #include <chrono>
+#include <optional>
 #include <cstdint>
+#include <vector>
+#include <algorithm>
 
 #include "src/DebugToolDrivers/USB/HID/HidInterface.hpp"
 
@@ -42,6 +45,33 @@ namespace DebugToolDrivers::Protocols::CmsisDap
             this->commandDelay = commandTimeGap;
         }
 
+        /**
+         * Sets the maximum number of commands that can be sent to the device before we wait for any responses.
+         *
+         * A value of 1 (the default) disables pipelining (every command is sent in lockstep with its response).
+         *
+         * Within a batch, commands are sent back-to-back - the minimum command time gap is only applied between
+         * batches. Some tools misbehave when commands are sent too quickly, so this should only be enabled when the
+         * user has opted in.
+         *
+         * @param commandCount
+         */
+        void setMaximumPipelinedCommands(std::uint8_t commandCount) {
+            this->maximumPipelinedCommands = std::max(commandCount, std::uint8_t{1});
+        }
+
+        std::uint8_t getMaximumPipelinedCommands() const {
+            return this->maximumPipelinedCommands;
+        }
+
+        /**
+         * Queries the device for the number of command packets it can buffer (via the DAP_Info command).
+         *
+         * @return
+         *  The packet count reported by the device, or std::nullopt if the device didn't report one.
+         */
+        std::optional<std::uint8_t> queryPacketCount();
+
         /**
          * Sends a CMSIS-DAP command to the device.
          *
@@ -105,7 +135,83 @@ namespace DebugToolDrivers::Protocols::CmsisDap
             return response;
         }
 
+        /**
+         * Sends multiple CMSIS-DAP commands and waits for their responses.
+         *
+         * If pipelining is enabled (see CmsisDapInterface::setMaximumPipelinedCommands()), the commands will be sent
+         * in batches, without waiting for the response to each command. The device responds to commands in the order
+         * in which they were received, so we match the responses by position (and verify their IDs).
+         *
+         * Otherwise, each command is sent in lockstep, via CmsisDapInterface::sendCommandAndWaitForResponse().
+         *
+         * @param cmsisDapCommands
+         *
+         * @return
+         *  The responses, in the same order as the commands.
+         */
+        template<class CommandType>
+        auto sendCommandsAndWaitForResponses(const std::vector<CommandType>& cmsisDapCommands) {
+            using ResponseType = typename CommandType::ExpectedResponseType;
+
+            auto responses = std::vector<ResponseType>();
+            responses.reserve(cmsisDapCommands.size());
+
+            if (this->maximumPipelinedCommands < 2) {
+                for (const auto& cmsisDapCommand : cmsisDapCommands) {
+                    responses.emplace_back(this->sendCommandAndWaitForResponse(cmsisDapCommand));
+                }
+
+                return responses;
+            }
+
+            auto batchStartIt = cmsisDapCommands.begin();
+            while (batchStartIt != cmsisDapCommands.end()) {
+                const auto batchEndIt = batchStartIt + std::min(
+                    static_cast<std::ptrdiff_t>(this->maximumPipelinedCommands),
+                    std::distance(batchStartIt, cmsisDapCommands.end())
+                );
+
+                /*
+                 * The minimum command time gap is applied between batches. The device has already told us that it
+                 * can buffer this many commands.
+                 */
+                this->sendCommand(*batchStartIt);
+                for (auto commandIt = batchStartIt + 1; commandIt != batchEndIt; ++commandIt) {
+                    this->writeCommand(*commandIt);
+                }
+
+                for (auto commandIt = batchStartIt; commandIt != batchEndIt; ++commandIt) {
+                    const auto rawResponse = this->getUsbHidInterface().readReport(std::chrono::milliseconds(60000));
+
+                    if (rawResponse.empty()) {
+                        throw Exceptions::DeviceCommunicationFailure("Empty CMSIS-DAP response received");
+                    }
+
+                    auto response = ResponseType(rawResponse);
+                    if (response.id != commandIt->id) {
+                        throw Exceptions::DeviceCommunicationFailure(
+                            "Unexpected response to pipelined CMSIS-DAP command."
+                        );
+                    }
+
+                    responses.emplace_back(std::move(response));
+                }
+
+                batchStartIt = batchEndIt;
+            }
+
+            return responses;
+        }
+
     private:
+        /**
+         * Serialises a CMSIS-DAP command into the reusable command buffer and writes it to the device. Unlike
+         * CmsisDapInterface::sendCommand(), this does not enforce the minimum command time gap.
+         *
+         * @param cmsisDapCommand
+         */
+        void writeCommand(const Command& cmsisDapCommand);
+
         /**
          * All CMSIS-DAP devices employ the USB HID interface for communication.
          *
@@ -115,6 +221,11 @@ namespace DebugToolDrivers::Protocols::CmsisDap
          */
         Usb::HidInterface usbHidInterface;
 
+        /**
+         * Reusable buffer for serialising commands. See CmsisDapInterface::writeCommand().
+         */
+        std::vector<unsigned char> commandBuffer;
+
         /**
          * Some CMSIS-DAP debug tools fail to operate properly when we send commands too quickly. Even if we've
          * received a response from every previous command.
@@ -123,5 +234,11 @@ namespace DebugToolDrivers::Protocols::CmsisDap
          */
         std::chrono::milliseconds commandDelay = std::chrono::milliseconds(0);
         std::int64_t lastCommandSentTimeStamp = 0;
+
+        /**
+         * The maximum number of commands we can send to the device, before waiting for responses. This should never
+         * exceed the packet count reported by the device. See CmsisDapInterface::queryPacketCount().
+         */
+        std::uint8_t maximumPipelinedCommands = 1;
     };
 }
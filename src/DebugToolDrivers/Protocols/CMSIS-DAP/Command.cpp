@@ -6,11 +6,10 @@ namespace DebugToolDrivers::Protocols::CmsisDap
         : id(commandId)
     {}
 
-    std::vector<unsigned char> Command::rawCommand() const {
-        auto rawCommand = std::vector<unsigned char>(1, this->id);
-        rawCommand.reserve(this->data.size() + 1);
-        rawCommand.insert(rawCommand.end(), this->data.begin(), this->data.end());
-
-        return rawCommand;
+    void Command::serialise(std::vector<unsigned char>& buffer) const {
+        buffer.clear();
+        buffer.reserve(this->data.size() + 1);
+        buffer.push_back(this->id);
+        buffer.insert(buffer.end(), this->data.begin(), this->data.end());
     }
 }
@@ -72,10 +72,13 @@ namespace DebugToolDrivers::Protocols::CmsisDap
         }
 
         /**
-         * Generates the raw CMSIS-DAP command, for sending to the CMSIS-DAP-enabled device.
+         * Writes the raw CMSIS-DAP command, for sending to the CMSIS-DAP-enabled device, to the given buffer,
+         * replacing its contents.
          *
-         * @return
+         * This allows the caller to reuse the same buffer for many commands, avoiding an allocation per command.
+         *
+         * @param buffer
          */
-        std::vector<unsigned char> rawCommand() const;
+        void serialise(std::vector<unsigned char>& buffer) const;
     };
 }
@@ -4,12 +4,12 @@
 
 namespace DebugToolDrivers::Protocols::CmsisDap
 {
-    Response::Response(const std::vector<unsigned char>& rawResponse) {
+    Response::Response(std::span<const unsigned char> rawResponse) {
         if (rawResponse.empty()) {
             throw Exceptions::Exception("Failed to process CMSIS-DAP response - invalid response");
         }
 
         this->id = rawResponse[0];
-        this->data = std::vector<unsigned char>(rawResponse.begin() + 1, rawResponse.end());
+        this->data.assign(rawResponse.begin() + 1, rawResponse.end());
     }
 }
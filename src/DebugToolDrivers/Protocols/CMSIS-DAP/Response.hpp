@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <span>
 
 namespace DebugToolDrivers::Protocols::CmsisDap
 {
@@ -10,7 +11,7 @@ namespace DebugToolDrivers::Protocols::CmsisDap
         unsigned char id = 0x00;
         std::vector<unsigned char> data;
 
-        Response(const std::vector<unsigned char>& rawResponse);
+        Response(std::span<const unsigned char> rawResponse);
         virtual ~Response() = default;
 
         Response(const Response& other) = default;
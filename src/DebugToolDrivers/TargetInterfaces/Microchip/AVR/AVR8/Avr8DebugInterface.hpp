@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <set>
+#include <vector>
 #include <optional>
 
 #include "src/Targets/Microchip/AVR/AVR8/Avr8TargetConfig.hpp"
@@ -109,6 +110,20 @@ namespace DebugToolDrivers::TargetInterfaces::Microchip::Avr::Avr8
          */
         virtual void clearSoftwareBreakpoint(Targets::TargetMemoryAddress address) = 0;
 
+        /**
+         * Should set software breakpoints at the given addresses, in as few operations as possible.
+         *
+         * @param addresses
+         */
+        virtual void setSoftwareBreakpoints(const std::vector<Targets::TargetMemoryAddress>& addresses) = 0;
+
+        /**
+         * Should remove software breakpoints at the given addresses, in as few operations as possible.
+         *
+         * @param addresses
+         */
+        virtual void clearSoftwareBreakpoints(const std::vector<Targets::TargetMemoryAddress>& addresses) = 0;
+
         /**
          * Should set a hardware breakpoint at a given address.
          *
@@ -40,19 +40,21 @@ namespace Usb
         ::hid_exit();
     }
 
-    std::vector<unsigned char> HidInterface::read(std::optional<std::chrono::milliseconds> timeout) {
-        auto output = std::vector<unsigned char>();
-
+    std::span<const unsigned char> HidInterface::read(std::optional<std::chrono::milliseconds> timeout) {
         const auto readSize = this->inputReportSize;
         auto transferredByteCount = int(0);
         auto totalByteCount = std::size_t(0);
 
         do {
-            output.resize(totalByteCount + readSize, 0x00);
+            /*
+             * The input buffer retains its capacity across reads, so this will only allocate when we receive more
+             * data than we've ever received before.
+             */
+            this->inputBuffer.resize(totalByteCount + readSize);
 
             transferredByteCount = ::hid_read_timeout(
                 this->hidDevice.get(),
-                output.data() + totalByteCount,
+                this->inputBuffer.data() + totalByteCount,
                 readSize,
                 timeout.has_value() ? static_cast<int>(timeout->count()) : -1
             );
@@ -70,11 +72,27 @@ namespace Usb
 
         } while (transferredByteCount >= readSize);
 
-        output.resize(totalByteCount, 0x00);
-        return output;
+        return std::span(this->inputBuffer).first(totalByteCount);
+    }
+
+    std::span<const unsigned char> HidInterface::readReport(std::optional<std::chrono::milliseconds> timeout) {
+        this->inputBuffer.resize(this->inputReportSize);
+
+        const auto transferredByteCount = ::hid_read_timeout(
+            this->hidDevice.get(),
+            this->inputBuffer.data(),
+            this->inputBuffer.size(),
+            timeout.has_value() ? static_cast<int>(timeout->count()) : -1
+        );
+
+        if (transferredByteCount == -1) {
+            throw DeviceCommunicationFailure("Failed to read from HID device.");
+        }
+
+        return std::span(this->inputBuffer).first(static_cast<std::size_t>(transferredByteCount));
     }
 
-    void HidInterface::write(std::vector<unsigned char>&& buffer) {
+    void HidInterface::write(std::span<const unsigned char> buffer) {
         if (buffer.size() > this->inputReportSize) {
             throw DeviceCommunicationFailure(
                 "Cannot send data via HID interface - data exceeds maximum packet size."
@@ -84,9 +102,12 @@ namespace Usb
         if (buffer.size() < this->inputReportSize) {
             /*
              * Every report we send via the USB HID interface should be of a fixed size.
-             * In the event of a report being too small, we just fill the buffer vector with 0.
+             * In the event of a report being too small, we copy it to the output buffer and fill the remaining bytes
+             * with 0.
              */
-            buffer.resize(this->inputReportSize, 0);
+            this->outputBuffer.assign(buffer.begin(), buffer.end());
+            this->outputBuffer.resize(this->inputReportSize, 0);
+            buffer = this->outputBuffer;
         }
 
         int transferred = 0;
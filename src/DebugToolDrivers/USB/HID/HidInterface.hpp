@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 #include <vector>
+#include <span>
 #include <optional>
 #include <chrono>
 
@@ -48,24 +49,52 @@ namespace Usb
         void close();
 
         /**
-         * Reads as much data as the device has to offer, into a vector.
+         * Reads as much data as the device has to offer.
+         *
+         * The data is read into a buffer that is reused across reads, to avoid allocating a new buffer for every
+         * report. The returned span is only valid until the next read.
+         *
+         * @param timeout
+         *
+         * @return
+         *  The data received from the device.
+         */
+        std::span<const unsigned char> read(std::optional<std::chrono::milliseconds> timeout = std::nullopt);
+
+        /**
+         * Reads a single report from the device.
+         *
+         * Unlike HidInterface::read(), this will not attempt to read any subsequent reports. This is required when
+         * the device has multiple responses queued, as each report carries a separate response.
+         *
+         * As with HidInterface::read(), the returned span is only valid until the next read.
          *
          * @param timeout
          *
          * @return
-         *  A vector of the data received from the device.
+         *  The report data, or an empty span if the timeout was reached.
          */
-        std::vector<unsigned char> read(std::optional<std::chrono::milliseconds> timeout = std::nullopt);
+        std::span<const unsigned char> readReport(std::optional<std::chrono::milliseconds> timeout = std::nullopt);
 
         /**
          * Writes buffer to HID output endpoint.
          *
+         * If the buffer is smaller than the report size, it will be padded with zeros (via a reusable buffer).
+         *
          * @param buffer
          */
-        void write(std::vector<unsigned char>&& buffer);
+        void write(std::span<const unsigned char> buffer);
 
         std::string getHidDevicePath();
 
+        std::uint16_t getVendorId() const {
+            return this->vendorId;
+        }
+
+        std::uint16_t getProductId() const {
+            return this->productId;
+        }
+
     private:
         using HidDevice = std::unique_ptr<::hid_device, decltype(&::hid_close)>;
 
@@ -73,5 +102,11 @@ namespace Usb
 
         std::uint16_t vendorId = 0;
         std::uint16_t productId = 0;
+
+        /**
+         * Reusable buffers for input and output reports. See HidInterface::read() and HidInterface::write().
+         */
+        std::vector<unsigned char> inputBuffer;
+        std::vector<unsigned char> outputBuffer;
     };
 }
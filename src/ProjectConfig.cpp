@@ -177,6 +177,28 @@ TargetConfig::TargetConfig(const YAML::Node& targetNode) {
         this->programMemoryCache = targetNode["programMemoryCache"].as<bool>(this->programMemoryCache);
     }
 
+    if (targetNode["programMemoryCacheReadAhead"]) {
+        this->programMemoryCacheReadAhead = targetNode["programMemoryCacheReadAhead"].as<std::uint32_t>(
+            this->programMemoryCacheReadAhead
+        );
+    }
+
+    if (targetNode["stopEpochCache"]) {
+        this->stopEpochCache = targetNode["stopEpochCache"].as<bool>(this->stopEpochCache);
+    }
+
+    if (targetNode["maximumStatePollingInterval"]) {
+        this->maximumStatePollingInterval = std::chrono::milliseconds(
+            targetNode["maximumStatePollingInterval"].as<int>(
+                static_cast<int>(this->maximumStatePollingInterval.count())
+            )
+        );
+
+        if (this->maximumStatePollingInterval.count() < 1) {
+            throw Exceptions::InvalidConfig("The maximum state polling interval must be at least 1 millisecond.");
+        }
+    }
+
     this->targetNode = targetNode;
 }
 
@@ -4,6 +4,8 @@
 #include <map>
 #include <string>
 #include <optional>
+#include <chrono>
+#include <cstdint>
 #include <yaml-cpp/yaml.h>
 
 /*
@@ -61,6 +63,33 @@ struct TargetConfig
      */
     bool programMemoryCache = true;
 
+    /**
+     * The number of bytes to read ahead of the requested address range, when populating the program memory cache.
+     *
+     * Program memory cache misses are always serviced with whole pages. The read-ahead extends the read into
+     * subsequent pages, so that sequential access (disassembly, stack unwinding, etc) results in fewer reads.
+     */
+    std::uint32_t programMemoryCacheReadAhead = 512;
+
+    /**
+     * Determines whether the TargetController will cache reads from the target's RAM, EEPROM and CPU registers,
+     * whilst the target is stopped. The cache is discarded whenever the target is resumed, stepped or reset.
+     *
+     * Peripheral registers (including those mapped into RAM) are never cached, as some peripherals continue to
+     * operate whilst the target is stopped.
+     */
+    bool stopEpochCache = true;
+
+    /**
+     * The maximum time the TargetController will wait between polling the target for state changes, whilst the
+     * target is running.
+     *
+     * The TargetController polls more frequently just after the target has resumed execution, and backs off
+     * towards this interval the longer the target runs. See TargetControllerComponent::getTargetStatePollingDelay()
+     * for more.
+     */
+    std::chrono::milliseconds maximumStatePollingInterval = std::chrono::milliseconds(60);
+
     /**
      * For extracting any target specific configuration. See Avr8TargetConfig::Avr8TargetConfig() and
      * Avr8::preActivationConfigure() for an example of this.
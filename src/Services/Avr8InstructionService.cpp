@@ -3,6 +3,8 @@
 namespace Services
 {
     using Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::Decoder;
+    using Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::CompactInstruction;
+    using Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::InstructionStream;
 
     Decoder::InstructionMapping Avr8InstructionService::fetchInstructions(
         const Targets::TargetMemoryAddressRange& addressRange,
@@ -18,6 +20,20 @@ namespace Services
         return Decoder::decode(addressRange.startAddress, programMemory);
     }
 
+    InstructionStream Avr8InstructionService::fetchInstructionStream(
+        const Targets::TargetMemoryAddressRange& addressRange,
+        const Targets::TargetDescriptor& targetDescriptor,
+        TargetControllerService& targetControllerService
+    ) {
+        const auto programMemory = targetControllerService.readMemory(
+            targetDescriptor.programMemoryType,
+            addressRange.startAddress,
+            addressRange.endAddress - addressRange.startAddress
+        );
+
+        return Decoder::decodeStream(addressRange.startAddress, programMemory);
+    }
+
     std::optional<Targets::TargetMemoryAddress> Avr8InstructionService::resolveProgramDestinationAddress(
         const Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::Instruction& instruction,
         Targets::TargetMemoryAddress instructionAddress,
@@ -44,4 +60,31 @@ namespace Services
 
         return std::nullopt;
     }
+
+    std::optional<Targets::TargetMemoryAddress> Avr8InstructionService::resolveProgramDestinationAddress(
+        const CompactInstruction& instruction,
+        Targets::TargetMemoryAddress instructionAddress,
+        const InstructionStream& instructions
+    ) {
+        assert(instruction.canChangeProgramFlow());
+
+        if (instruction.hasProgramWordAddress()) {
+            return instruction.programWordAddress * 2;
+        }
+
+        if (instruction.hasProgramWordAddressOffset()) {
+            return static_cast<std::int64_t>(instructionAddress) + (instruction.programWordAddressOffset * 2) + 2;
+        }
+
+        if (instruction.canSkipNextInstruction()) {
+            const auto subsequentInstructionAddress = instructionAddress + instruction.byteSize;
+            const auto* subsequentInstruction = instructions.find(subsequentInstructionAddress);
+
+            if (subsequentInstruction != nullptr && subsequentInstruction->decoded()) {
+                return subsequentInstructionAddress + subsequentInstruction->byteSize;
+            }
+        }
+
+        return std::nullopt;
+    }
 }
@@ -5,6 +5,7 @@
 #include "src/Targets/TargetDescriptor.hpp"
 #include "src/Targets/TargetMemory.hpp"
 #include "src/Targets/Microchip/AVR/AVR8/OpcodeDecoder/Instruction.hpp"
+#include "src/Targets/Microchip/AVR/AVR8/OpcodeDecoder/InstructionStream.hpp"
 #include "src/Targets/Microchip/AVR/AVR8/OpcodeDecoder/Decoder.hpp"
 
 namespace Services
@@ -29,6 +30,25 @@ namespace Services
             TargetControllerService& targetControllerService
         );
 
+        /**
+         * Fetches opcodes from the target's program memory and decodes them into an InstructionStream.
+         *
+         * Prefer this over fetchInstructions() for large address ranges - see Decoder::decodeStream().
+         *
+         * @param addressRange
+         *  The address range to fetch. addressRange.endAddress is exclusive.
+         *
+         * @param targetDescriptor
+         * @param targetControllerService
+         *
+         * @return
+         */
+        static Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::InstructionStream fetchInstructionStream(
+            const Targets::TargetMemoryAddressRange& addressRange,
+            const Targets::TargetDescriptor& targetDescriptor,
+            TargetControllerService& targetControllerService
+        );
+
         /**
          * For instructions that can change program flow, this function will attempt to figure out where, in program
          * memory, the instruction may jump to.
@@ -66,5 +86,26 @@ namespace Services
             Targets::TargetMemoryAddress instructionAddress,
             const Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::Decoder::InstructionMapping& instructions
         );
+
+        /**
+         * Same as the InstructionMapping overload above, but for records in an InstructionStream.
+         *
+         * @param instruction
+         *  The subject instruction record. Must have the FLAG_CAN_CHANGE_PROGRAM_FLOW flag.
+         *
+         * @param instructionAddress
+         *  The byte address of the subject instruction.
+         *
+         * @param instructions
+         *  The InstructionStream from which the subject instruction record was taken. We'll look up the subsequent
+         *  instruction here, for instructions that skip it.
+         *
+         * @return
+         */
+        static std::optional<Targets::TargetMemoryAddress> resolveProgramDestinationAddress(
+            const Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::CompactInstruction& instruction,
+            Targets::TargetMemoryAddress instructionAddress,
+            const Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::InstructionStream& instructions
+        );
     };
 }
@@ -0,0 +1,380 @@
+#include "Avr8ProgramAnalysisService.hpp"
+
+#include <algorithm>
+#include <future>
+#include <thread>
+
+#include "Avr8InstructionService.hpp"
+#include "StringService.hpp"
+
+#include "src/Targets/Microchip/AVR/AVR8/OpcodeDecoder/Decoder.hpp"
+#include "src/Logger/Logger.hpp"
+
+namespace Services
+{
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemoryBuffer;
+
+    using Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::Decoder;
+    using Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::Instruction;
+    using Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::CompactInstruction;
+    using Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::InstructionStream;
+
+    const Avr8ProgramAnalysisService::BasicBlock* Avr8ProgramAnalysisService::ProgramAnalysis::basicBlockAt(
+        TargetMemoryAddress address
+    ) const {
+        auto blockIt = this->basicBlocksByStartAddress.upper_bound(address);
+
+        if (blockIt == this->basicBlocksByStartAddress.begin()) {
+            return nullptr;
+        }
+
+        --blockIt;
+        return address < blockIt->second.endAddress ? &(blockIt->second) : nullptr;
+    }
+
+    std::shared_ptr<const Avr8ProgramAnalysisService::ProgramAnalysis> Avr8ProgramAnalysisService::analyseProgramMemory(
+        const Targets::TargetDescriptor& targetDescriptor,
+        TargetControllerService& targetControllerService
+    ) {
+        const auto& programMemoryAddressRange = targetDescriptor.memoryDescriptorsByType.at(
+            targetDescriptor.programMemoryType
+        ).addressRange;
+
+        auto programMemory = targetControllerService.readMemory(
+            targetDescriptor.programMemoryType,
+            programMemoryAddressRange.startAddress,
+            programMemoryAddressRange.endAddress - programMemoryAddressRange.startAddress + 1
+        );
+
+        const auto programMemoryHash = Avr8ProgramAnalysisService::hash(programMemory);
+
+        const auto entryIt = std::find_if(
+            this->cache.begin(),
+            this->cache.end(),
+            [programMemoryHash, &programMemory] (const CacheEntry& entry) {
+                return entry.programMemoryHash == programMemoryHash
+                    && entry.analysis->programMemory == programMemory;
+            }
+        );
+
+        if (entryIt != this->cache.end()) {
+            Logger::debug("Using cached program memory analysis");
+            this->cache.splice(this->cache.begin(), this->cache, entryIt);
+
+        } else {
+            this->cache.push_front(CacheEntry{
+                .programMemoryHash = programMemoryHash,
+                .analysis = Avr8ProgramAnalysisService::analyse(
+                    programMemoryAddressRange.startAddress,
+                    std::move(programMemory)
+                ),
+            });
+
+            if (this->cache.size() > Avr8ProgramAnalysisService::MAX_CACHE_ENTRIES) {
+                this->cache.pop_back();
+            }
+        }
+
+        this->current = this->cache.front().analysis;
+        return this->current;
+    }
+
+    std::shared_ptr<const Avr8ProgramAnalysisService::ProgramAnalysis> Avr8ProgramAnalysisService::currentAnalysis(
+    ) const {
+        return this->current;
+    }
+
+    void Avr8ProgramAnalysisService::invalidateCurrentAnalysis() {
+        this->current.reset();
+    }
+
+    InstructionStream Avr8ProgramAnalysisService::decodeInParallel(
+        TargetMemoryAddress startByteAddress,
+        const TargetMemoryBuffer& data
+    ) {
+        const auto wordCount = data.size() / 2;
+        const auto chunkCount = std::clamp(
+            std::min(
+                static_cast<std::size_t>(std::thread::hardware_concurrency()),
+                data.size() / Avr8ProgramAnalysisService::MIN_CHUNK_SIZE
+            ),
+            std::size_t{1},
+            wordCount > 0 ? wordCount : std::size_t{1}
+        );
+
+        if (chunkCount == 1) {
+            return Decoder::decodeStream(startByteAddress, data);
+        }
+
+        const auto chunkWordCount = (wordCount + chunkCount - 1) / chunkCount;
+
+        /*
+         * Each chunk is decoded independently, with one extra word, so that a 32-bit instruction at the end of the
+         * chunk can be decoded. Such an instruction will cross into the subsequent chunk, which would have been
+         * decoded from the wrong boundary. We deal with that below, once all chunks have been decoded.
+         */
+        auto chunkDecodes = std::vector<std::future<InstructionStream>>();
+        for (auto chunkStartWord = std::size_t{0}; chunkStartWord < wordCount; chunkStartWord += chunkWordCount) {
+            const auto chunkEndWord = std::min(chunkStartWord + chunkWordCount + 1, wordCount);
+
+            chunkDecodes.emplace_back(std::async(
+                std::launch::async,
+                [startByteAddress, &data, chunkStartWord, chunkEndWord] {
+                    return Decoder::decodeStream(
+                        static_cast<TargetMemoryAddress>(startByteAddress + chunkStartWord * 2),
+                        TargetMemoryBuffer(data.begin() + chunkStartWord * 2, data.begin() + chunkEndWord * 2)
+                    );
+                }
+            ));
+        }
+
+        auto output = InstructionStream{
+            .startByteAddress = startByteAddress,
+            .records = std::vector<CompactInstruction>(),
+        };
+        output.records.reserve(wordCount);
+
+        for (auto& chunkDecode : chunkDecodes) {
+            const auto chunk = chunkDecode.get();
+            const auto chunkRecordCount = std::min(chunkWordCount, wordCount - output.records.size());
+
+            output.records.insert(
+                output.records.end(),
+                chunk.records.begin(),
+                chunk.records.begin() + static_cast<std::ptrdiff_t>(chunkRecordCount)
+            );
+        }
+
+        for (auto chunkEndWord = chunkWordCount; chunkEndWord < wordCount; chunkEndWord += chunkWordCount) {
+            if (output.records[chunkEndWord - 1].byteSize == 4) {
+                // The last instruction in the chunk crosses into the subsequent chunk
+                output.records[chunkEndWord] = CompactInstruction();
+                Avr8ProgramAnalysisService::resynchronise(output.records, chunkEndWord + 1, data);
+            }
+        }
+
+        return output;
+    }
+
+    std::uint64_t Avr8ProgramAnalysisService::hash(const TargetMemoryBuffer& data) {
+        // FNV-1a
+        auto hash = std::uint64_t{0xCBF29CE484222325};
+
+        for (const auto byte : data) {
+            hash = (hash ^ byte) * 0x00000100000001B3;
+        }
+
+        return hash;
+    }
+
+    void Avr8ProgramAnalysisService::resynchronise(
+        std::vector<CompactInstruction>& records,
+        std::size_t wordIndex,
+        const TargetMemoryBuffer& data
+    ) {
+        /*
+         * A record that isn't a continuation marks an instruction boundary in the original decoding. Once we reach
+         * one, both decodings will be identical from that point onwards.
+         */
+        while (wordIndex < records.size() && records[wordIndex].isContinuation()) {
+            const auto byteOffset = wordIndex * 2;
+            const auto record = Decoder::decodeStream(
+                0,
+                TargetMemoryBuffer(
+                    data.begin() + static_cast<std::ptrdiff_t>(byteOffset),
+                    data.begin() + static_cast<std::ptrdiff_t>(std::min(byteOffset + 4, records.size() * 2))
+                )
+            ).records.front();
+
+            records[wordIndex] = record;
+
+            if (record.byteSize == 4) {
+                records[wordIndex + 1] = CompactInstruction();
+            }
+
+            wordIndex += record.byteSize / 2;
+        }
+    }
+
+    std::shared_ptr<const Avr8ProgramAnalysisService::ProgramAnalysis> Avr8ProgramAnalysisService::analyse(
+        TargetMemoryAddress startByteAddress,
+        TargetMemoryBuffer&& programMemory
+    ) {
+        using Mnemonic = Instruction::Mnemonic;
+
+        auto output = std::make_shared<ProgramAnalysis>();
+        output->programMemory = std::move(programMemory);
+
+        /*
+         * There's no point in analysing the unprogrammed (erased) words at the end of the program memory - they'd
+         * only produce a large number of meaningless basic blocks.
+         */
+        auto programmedSize = output->programMemory.size() - (output->programMemory.size() % 2);
+        while (
+            programmedSize >= 2
+            && output->programMemory[programmedSize - 1] == 0xFF
+            && output->programMemory[programmedSize - 2] == 0xFF
+        ) {
+            programmedSize -= 2;
+        }
+
+        output->instructions = Avr8ProgramAnalysisService::decodeInParallel(
+            startByteAddress,
+            TargetMemoryBuffer(
+                output->programMemory.begin(),
+                output->programMemory.begin() + static_cast<std::ptrdiff_t>(programmedSize)
+            )
+        );
+
+        const auto& instructions = output->instructions;
+        const auto& records = instructions.records;
+
+        const auto recordIndex = [&instructions] (TargetMemoryAddress address) {
+            return static_cast<std::size_t>((address - instructions.startByteAddress) / 2);
+        };
+
+        const auto recordAddress = [&instructions] (std::size_t index) {
+            return static_cast<TargetMemoryAddress>(instructions.startByteAddress + index * 2);
+        };
+
+        const auto isCall = [] (const CompactInstruction& instruction) {
+            return instruction.mnemonic == Mnemonic::CALL
+                || instruction.mnemonic == Mnemonic::RCALL
+                || instruction.mnemonic == Mnemonic::ICALL
+                || instruction.mnemonic == Mnemonic::EICALL;
+        };
+
+        const auto hasFallThrough = [&isCall] (const CompactInstruction& instruction) {
+            return isCall(instruction)
+                || !(
+                    instruction.mnemonic == Mnemonic::JMP
+                    || instruction.mnemonic == Mnemonic::RJMP
+                    || instruction.mnemonic == Mnemonic::IJMP
+                    || instruction.mnemonic == Mnemonic::EIJMP
+                    || instruction.mnemonic == Mnemonic::RET
+                    || instruction.mnemonic == Mnemonic::RETI
+                );
+        };
+
+        /*
+         * First pass: resolve the destinations of all instructions that can change program flow, and mark the
+         * beginning of each basic block.
+         */
+        auto blockStarts = std::vector<bool>(records.size(), false);
+        auto destinationAddresses = std::map<std::size_t, TargetMemoryAddress>();
+
+        if (!records.empty()) {
+            blockStarts[0] = true;
+        }
+
+        for (auto index = std::size_t{0}; index < records.size(); index += std::max(records[index].byteSize / 2, 1)) {
+            const auto& instruction = records[index];
+            const auto nextIndex = index + instruction.byteSize / 2;
+
+            if (!instruction.decoded()) {
+                ++(output->undecodedWordCount);
+
+                if (nextIndex < records.size()) {
+                    blockStarts[nextIndex] = true;
+                }
+
+                continue;
+            }
+
+            if (!instruction.canChangeProgramFlow()) {
+                continue;
+            }
+
+            if (nextIndex < records.size()) {
+                blockStarts[nextIndex] = true;
+            }
+
+            const auto address = recordAddress(index);
+            const auto destinationAddress = Avr8InstructionService::resolveProgramDestinationAddress(
+                instruction,
+                address,
+                instructions
+            );
+
+            if (!destinationAddress.has_value() || instructions.find(*destinationAddress) == nullptr) {
+                // Either we couldn't resolve the destination, or it isn't the start of an instruction
+                continue;
+            }
+
+            destinationAddresses.emplace(index, *destinationAddress);
+            blockStarts[recordIndex(*destinationAddress)] = true;
+
+            if (isCall(instruction)) {
+                output->callSiteAddressesByCallee[*destinationAddress].insert(address);
+
+            } else {
+                output->branchSourceAddressesByTarget[*destinationAddress].insert(address);
+            }
+        }
+
+        /*
+         * Second pass: construct the basic blocks.
+         */
+        auto block = std::optional<BasicBlock>();
+
+        for (auto index = std::size_t{0}; index < records.size(); index += std::max(records[index].byteSize / 2, 1)) {
+            const auto& instruction = records[index];
+            const auto address = recordAddress(index);
+            const auto nextAddress = static_cast<TargetMemoryAddress>(address + instruction.byteSize);
+
+            if (blockStarts[index]) {
+                if (block.has_value()) {
+                    // The previous block falls through to this one
+                    block->endAddress = address;
+                    block->successorAddresses.insert(address);
+                    output->basicBlocksByStartAddress.emplace(block->startAddress, std::move(*block));
+                }
+
+                block = BasicBlock{.startAddress = address};
+            }
+
+            const auto terminatesBlock = !instruction.decoded() || instruction.canChangeProgramFlow();
+            if (!terminatesBlock) {
+                continue;
+            }
+
+            block->endAddress = nextAddress;
+
+            if (!instruction.decoded()) {
+                block->hasUnresolvedSuccessor = true;
+
+            } else {
+                const auto destinationIt = destinationAddresses.find(index);
+
+                if (destinationIt == destinationAddresses.end()) {
+                    block->hasUnresolvedSuccessor = true;
+
+                } else if (!isCall(instruction)) {
+                    block->successorAddresses.insert(destinationIt->second);
+                }
+
+                if (hasFallThrough(instruction) && instructions.find(nextAddress) != nullptr) {
+                    block->successorAddresses.insert(nextAddress);
+                }
+            }
+
+            output->basicBlocksByStartAddress.emplace(block->startAddress, std::move(*block));
+            block = std::nullopt;
+        }
+
+        if (block.has_value()) {
+            block->endAddress = instructions.endByteAddress();
+            output->basicBlocksByStartAddress.emplace(block->startAddress, std::move(*block));
+        }
+
+        Logger::debug(
+            "Analysed " + std::to_string(programmedSize) + " bytes of program memory - "
+                + std::to_string(output->basicBlocksByStartAddress.size()) + " basic blocks, "
+                + std::to_string(output->callSiteAddressesByCallee.size()) + " call destinations, "
+                + std::to_string(output->undecodedWordCount) + " undecoded words"
+        );
+
+        return output;
+    }
+}
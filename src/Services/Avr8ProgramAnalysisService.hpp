@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <map>
+#include <set>
+#include <list>
+
+#include "TargetControllerService.hpp"
+
+#include "src/Targets/TargetDescriptor.hpp"
+#include "src/Targets/TargetMemory.hpp"
+#include "src/Targets/Microchip/AVR/AVR8/OpcodeDecoder/InstructionStream.hpp"
+
+namespace Services
+{
+    /**
+     * Decodes the target's entire program memory and performs static control flow analysis on it.
+     *
+     * The program memory is read in a single read, which the TargetController will service from its program memory
+     * cache, where possible. The analysis results are cached by the content of the program memory, so analysing the
+     * same program again (for example, after reprogramming the target with the same image) will not require decoding
+     * it again.
+     *
+     * Instances of this class are not thread-safe.
+     */
+    class Avr8ProgramAnalysisService
+    {
+    public:
+        struct BasicBlock
+        {
+            Targets::TargetMemoryAddress startAddress = 0;
+
+            /**
+             * Exclusive.
+             */
+            Targets::TargetMemoryAddress endAddress = 0;
+
+            /**
+             * Byte addresses of all basic blocks that execution may continue to, from this block, that we could
+             * resolve statically. Calls are not included here - execution continues to the subsequent block, after
+             * the call returns.
+             */
+            std::set<Targets::TargetMemoryAddress> successorAddresses;
+
+            /**
+             * True if this block ends in an instruction whose destination we could not resolve (indirect jumps,
+             * returns, words we failed to decode, etc.).
+             */
+            bool hasUnresolvedSuccessor = false;
+        };
+
+        struct ProgramAnalysis
+        {
+            /**
+             * The program memory that was analysed.
+             */
+            Targets::TargetMemoryBuffer programMemory;
+
+            Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::InstructionStream instructions;
+
+            std::map<Targets::TargetMemoryAddress, BasicBlock> basicBlocksByStartAddress;
+
+            /**
+             * The call graph. Maps the destination byte address of every direct call (CALL and RCALL) to the byte
+             * addresses of the instructions that call it.
+             */
+            std::map<Targets::TargetMemoryAddress, std::set<Targets::TargetMemoryAddress>> callSiteAddressesByCallee;
+
+            /**
+             * Maps the destination byte address of every jump, branch and skip instruction to the byte addresses of
+             * the instructions that may jump to it.
+             */
+            std::map<
+                Targets::TargetMemoryAddress,
+                std::set<Targets::TargetMemoryAddress>
+            > branchSourceAddressesByTarget;
+
+            std::uint32_t undecodedWordCount = 0;
+
+            /**
+             * Returns the basic block that contains the given byte address.
+             *
+             * @param address
+             *
+             * @return
+             *  nullptr if the address isn't within any basic block.
+             */
+            [[nodiscard]] const BasicBlock* basicBlockAt(Targets::TargetMemoryAddress address) const;
+        };
+
+        /**
+         * Reads the target's program memory and returns its analysis, performing the analysis if we don't already
+         * have the results for the current program.
+         *
+         * The returned analysis becomes the current analysis - see Avr8ProgramAnalysisService::currentAnalysis().
+         *
+         * @param targetDescriptor
+         * @param targetControllerService
+         *
+         * @return
+         */
+        std::shared_ptr<const ProgramAnalysis> analyseProgramMemory(
+            const Targets::TargetDescriptor& targetDescriptor,
+            TargetControllerService& targetControllerService
+        );
+
+        /**
+         * Returns the most recent analysis, if the program memory hasn't changed since it was performed.
+         *
+         * This does not require access to the target.
+         *
+         * @return
+         *  nullptr if we have no analysis for the current program memory.
+         */
+        [[nodiscard]] std::shared_ptr<const ProgramAnalysis> currentAnalysis() const;
+
+        /**
+         * Should be called when the target's program memory may have changed.
+         *
+         * Cached analyses are kept, as they're mapped by the program memory content.
+         */
+        void invalidateCurrentAnalysis();
+
+        /**
+         * Same as Decoder::decodeStream(), but splits the data into chunks, which are decoded concurrently.
+         *
+         * @param startByteAddress
+         * @param data
+         *
+         * @return
+         */
+        static Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::InstructionStream decodeInParallel(
+            Targets::TargetMemoryAddress startByteAddress,
+            const Targets::TargetMemoryBuffer& data
+        );
+
+    private:
+        struct CacheEntry
+        {
+            std::uint64_t programMemoryHash = 0;
+            std::shared_ptr<const ProgramAnalysis> analysis;
+        };
+
+        /**
+         * The maximum number of analyses we'll keep in the cache. Each analysis holds a copy of the program memory,
+         * along with its instruction stream (6 bytes per byte of program memory).
+         */
+        static constexpr auto MAX_CACHE_ENTRIES = std::size_t{4};
+
+        /**
+         * Chunks smaller than this aren't worth a thread.
+         */
+        static constexpr auto MIN_CHUNK_SIZE = std::size_t{16384};
+
+        /**
+         * Most recently used first.
+         */
+        std::list<CacheEntry> cache;
+
+        std::shared_ptr<const ProgramAnalysis> current;
+
+        static std::uint64_t hash(const Targets::TargetMemoryBuffer& data);
+
+        /**
+         * Re-decodes the instructions following a 32-bit instruction that crosses a chunk border, until the
+         * instruction boundaries realign with the chunk's original decoding.
+         *
+         * @param records
+         * @param wordIndex
+         *  The index of the first word after the 32-bit instruction.
+         *
+         * @param data
+         */
+        static void resynchronise(
+            std::vector<Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::CompactInstruction>& records,
+            std::size_t wordIndex,
+            const Targets::TargetMemoryBuffer& data
+        );
+
+        static std::shared_ptr<const ProgramAnalysis> analyse(
+            Targets::TargetMemoryAddress startByteAddress,
+            Targets::TargetMemoryBuffer&& programMemory
+        );
+    };
+}
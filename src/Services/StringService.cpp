@@ -1,12 +1,51 @@
 #include "StringService.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cctype>
-#include <sstream>
-#include <iomanip>
+
+#include "src/Exceptions/Exception.hpp"
 
 namespace Services
 {
+    using Exceptions::Exception;
+
+    namespace
+    {
+        constexpr auto HEX_DIGITS = std::string_view("0123456789abcdef");
+
+        /**
+         * Maps ASCII characters to their hexadecimal digit values. Non-hexadecimal characters map to 0xFF.
+         */
+        constexpr auto HEX_DIGIT_VALUES = [] {
+            auto values = std::array<unsigned char, 256>();
+            values.fill(0xFF);
+
+            for (auto i = 0; i < 10; ++i) {
+                values['0' + i] = static_cast<unsigned char>(i);
+            }
+
+            for (auto i = 0; i < 6; ++i) {
+                values['a' + i] = static_cast<unsigned char>(10 + i);
+                values['A' + i] = static_cast<unsigned char>(10 + i);
+            }
+
+            return values;
+        }();
+
+        template <typename OutputType>
+        void encodeHex(std::span<const unsigned char> data, OutputType& output) {
+            const auto offset = output.size();
+            output.resize(offset + (data.size() * 2));
+
+            auto outputIt = output.begin() + static_cast<std::ptrdiff_t>(offset);
+            for (const auto byte : data) {
+                *(outputIt++) = HEX_DIGITS[byte >> 4];
+                *(outputIt++) = HEX_DIGITS[byte & 0x0F];
+            }
+        }
+    }
+
     std::string StringService::asciiToLower(std::string str) {
         std::transform(str.begin(), str.end(), str.begin(), [] (unsigned char character) {
             return std::tolower(character);
@@ -38,36 +77,81 @@ namespace Services
     }
 
     std::string StringService::toHex(std::uint32_t value) {
-        auto stream = std::stringstream();
-        stream << std::hex << std::setfill('0') << std::setw(8) << static_cast<unsigned int>(value);
-        return stream.str();
+        auto output = std::string(8, '0');
+
+        for (auto i = 7; i >= 0; --i) {
+            output[static_cast<std::size_t>(i)] = HEX_DIGITS[value & 0x0F];
+            value >>= 4;
+        }
+
+        return output;
     }
 
     std::string StringService::toHex(unsigned char value) {
-        auto stream = std::stringstream();
-        stream << std::hex << std::setfill('0') << std::setw(2) << static_cast<unsigned int>(value);
-        return stream.str();
+        return {HEX_DIGITS[value >> 4], HEX_DIGITS[value & 0x0F]};
     }
 
     std::string StringService::toHex(const std::vector<unsigned char>& data) {
-        auto stream = std::stringstream();
-        stream << std::hex << std::setfill('0');
+        auto output = std::string();
+        encodeHex(data, output);
+        return output;
+    }
+
+    std::string StringService::toHex(const std::string& data) {
+        auto output = std::string();
+        encodeHex(
+            std::span(reinterpret_cast<const unsigned char*>(data.data()), data.size()),
+            output
+        );
+        return output;
+    }
+
+    void StringService::appendHex(std::span<const unsigned char> data, std::vector<unsigned char>& output) {
+        encodeHex(data, output);
+    }
+
+    std::vector<unsigned char> StringService::dataFromHex(std::string_view hexData) {
+        if ((hexData.size() % 2) != 0) {
+            throw Exception("Invalid hex data - odd number of characters");
+        }
+
+        auto output = std::vector<unsigned char>(hexData.size() / 2);
+
+        for (std::size_t i = 0; i < output.size(); ++i) {
+            const auto upper = HEX_DIGIT_VALUES[static_cast<unsigned char>(hexData[i * 2])];
+            const auto lower = HEX_DIGIT_VALUES[static_cast<unsigned char>(hexData[(i * 2) + 1])];
+
+            if ((upper | lower) == 0xFF) {
+                throw Exception("Invalid hex data - unexpected character");
+            }
 
-        for (const auto& byte : data) {
-            stream << std::setw(2) << static_cast<unsigned int>(byte);
+            output[i] = static_cast<unsigned char>((upper << 4) | lower);
         }
 
-        return stream.str();
+        return output;
     }
 
-    std::string StringService::toHex(const std::string& data) {
-        std::stringstream stream;
-        stream << std::hex << std::setfill('0');
+    std::uint32_t StringService::uint32FromHex(std::string_view hexValue) {
+        if (hexValue.empty()) {
+            throw Exception("Invalid hex value - empty string");
+        }
+
+        auto output = std::uint32_t{0};
+
+        for (const auto character : hexValue) {
+            const auto digit = HEX_DIGIT_VALUES[static_cast<unsigned char>(character)];
+
+            if (digit == 0xFF) {
+                throw Exception("Invalid hex value - unexpected character");
+            }
+
+            if ((output >> 28) != 0) {
+                throw Exception("Invalid hex value - value exceeds 32 bits");
+            }
 
-        for (const auto& byte : data) {
-            stream << std::setw(2) << static_cast<unsigned int>(byte);
+            output = (output << 4) | digit;
         }
 
-        return stream.str();
+        return output;
     }
 }
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <vector>
+#include <span>
 
 namespace Services
 {
@@ -20,5 +22,37 @@ namespace Services
         static std::string toHex(unsigned char value);
         static std::string toHex(const std::vector<unsigned char>& data);
         static std::string toHex(const std::string& data);
+
+        /**
+         * Appends the hexadecimal (lowercase) form of the given data to the output buffer.
+         *
+         * This allows callers to encode data straight into a preallocated packet buffer, without an intermediate
+         * string.
+         *
+         * @param data
+         * @param output
+         */
+        static void appendHex(std::span<const unsigned char> data, std::vector<unsigned char>& output);
+
+        /**
+         * Converts data in hexadecimal form to raw data.
+         *
+         * Throws an exception if the given string is of odd length or contains non-hexadecimal characters.
+         *
+         * @param hexData
+         * @return
+         */
+        static std::vector<unsigned char> dataFromHex(std::string_view hexData);
+
+        /**
+         * Parses an unsigned 32-bit integer from its hexadecimal form.
+         *
+         * Throws an exception if the given string is empty, contains non-hexadecimal characters or holds a value
+         * that doesn't fit into 32 bits.
+         *
+         * @param hexValue
+         * @return
+         */
+        static std::uint32_t uint32FromHex(std::string_view hexValue);
     };
 }
@@ -16,6 +16,8 @@
 #include "src/TargetController/Commands/StepTargetExecution.hpp"
 #include "src/TargetController/Commands/SetBreakpoint.hpp"
 #include "src/TargetController/Commands/RemoveBreakpoint.hpp"
+#include "src/TargetController/Commands/SetBreakpoints.hpp"
+#include "src/TargetController/Commands/RemoveBreakpoints.hpp"
 #include "src/TargetController/Commands/SetTargetProgramCounter.hpp"
 #include "src/TargetController/Commands/GetTargetPinStates.hpp"
 #include "src/TargetController/Commands/SetTargetPinState.hpp"
@@ -23,6 +25,7 @@
 #include "src/TargetController/Commands/GetTargetProgramCounter.hpp"
 #include "src/TargetController/Commands/EnableProgrammingMode.hpp"
 #include "src/TargetController/Commands/DisableProgrammingMode.hpp"
+#include "src/TargetController/Commands/GetCacheStatistics.hpp"
 #include "src/TargetController/Commands/Shutdown.hpp"
 
 #include "src/Exceptions/Exception.hpp"
@@ -44,6 +47,8 @@ namespace Services
     using TargetController::Commands::StepTargetExecution;
     using TargetController::Commands::SetBreakpoint;
     using TargetController::Commands::RemoveBreakpoint;
+    using TargetController::Commands::SetBreakpoints;
+    using TargetController::Commands::RemoveBreakpoints;
     using TargetController::Commands::SetTargetProgramCounter;
     using TargetController::Commands::GetTargetPinStates;
     using TargetController::Commands::SetTargetPinState;
@@ -51,6 +56,7 @@ namespace Services
     using TargetController::Commands::GetTargetProgramCounter;
     using TargetController::Commands::EnableProgrammingMode;
     using TargetController::Commands::DisableProgrammingMode;
+    using TargetController::Commands::GetCacheStatistics;
     using TargetController::Commands::Shutdown;
 
     using Targets::TargetDescriptor;
@@ -211,6 +217,21 @@ namespace Services
         );
     }
 
+    TargetController::Commands::CommandIdType TargetControllerService::startMemoryWrite(
+        TargetMemoryType memoryType,
+        TargetMemoryAddress startAddress,
+        TargetMemoryBuffer&& buffer
+    ) const {
+        return this->commandManager.sendCommand(
+            std::make_unique<WriteTargetMemory>(memoryType, startAddress, std::move(buffer)),
+            this->activeAtomicSessionId
+        );
+    }
+
+    void TargetControllerService::waitForMemoryWrite(TargetController::Commands::CommandIdType commandId) const {
+        this->commandManager.waitForResponse<WriteTargetMemory>(commandId, this->defaultTimeout);
+    }
+
     void TargetControllerService::eraseMemory(Targets::TargetMemoryType memoryType) const {
         this->commandManager.sendCommandAndWaitForResponse(
             std::make_unique<EraseTargetMemory>(memoryType),
@@ -238,6 +259,25 @@ namespace Services
         );
     }
 
+    std::vector<TargetBreakpoint> TargetControllerService::setBreakpoints(
+        const std::vector<TargetMemoryAddress>& addresses,
+        TargetBreakpoint::Type preferredType
+    ) const {
+        return this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<SetBreakpoints>(addresses, preferredType),
+            this->defaultTimeout,
+            this->activeAtomicSessionId
+        )->breakpoints;
+    }
+
+    void TargetControllerService::removeBreakpoints(const std::vector<TargetBreakpoint>& breakpoints) const {
+        this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<RemoveBreakpoints>(breakpoints),
+            this->defaultTimeout,
+            this->activeAtomicSessionId
+        );
+    }
+
     TargetMemoryAddress TargetControllerService::getProgramCounter() const {
         return this->commandManager.sendCommandAndWaitForResponse(
             std::make_unique<GetTargetProgramCounter>(),
@@ -302,6 +342,14 @@ namespace Services
         );
     }
 
+    TargetController::Responses::CacheStatistics TargetControllerService::getCacheStatistics() const {
+        return *(this->commandManager.sendCommandAndWaitForResponse(
+            std::make_unique<GetCacheStatistics>(),
+            this->defaultTimeout,
+            this->activeAtomicSessionId
+        ));
+    }
+
     void TargetControllerService::shutdown() const {
         this->commandManager.sendCommandAndWaitForResponse(
             std::make_unique<Shutdown>(),
@@ -3,10 +3,12 @@
 #include <cstdint>
 #include <chrono>
 #include <optional>
+#include <vector>
 #include <functional>
 
 #include "src/TargetController/CommandManager.hpp"
 #include "src/TargetController/AtomicSession.hpp"
+#include "src/TargetController/Responses/CacheStatistics.hpp"
 
 #include "src/Targets/TargetState.hpp"
 #include "src/Targets/TargetRegister.hpp"
@@ -134,6 +136,35 @@ namespace Services
             const Targets::TargetMemoryBuffer& buffer
         ) const;
 
+        /**
+         * Requests the TargetController to write memory to the target, without waiting for the write to complete.
+         *
+         * The TargetController will carry out the write in the background, whilst the caller continues with other
+         * work. The caller must then collect the outcome of the write via
+         * TargetControllerService::waitForMemoryWrite().
+         *
+         * @param memoryType
+         * @param startAddress
+         * @param buffer
+         *
+         * @return
+         *  The ID of the issued command, to be passed to TargetControllerService::waitForMemoryWrite().
+         */
+        TargetController::Commands::CommandIdType startMemoryWrite(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemoryBuffer&& buffer
+        ) const;
+
+        /**
+         * Waits for a memory write that was started via TargetControllerService::startMemoryWrite() to complete.
+         *
+         * Throws an exception if the write failed.
+         *
+         * @param commandId
+         */
+        void waitForMemoryWrite(TargetController::Commands::CommandIdType commandId) const;
+
         /**
          * Requests the TargetController to erase the given target memory type.
          *
@@ -162,6 +193,27 @@ namespace Services
          */
         void removeBreakpoint(Targets::TargetBreakpoint breakpoint) const;
 
+        /**
+         * Requests the TargetController to set multiple breakpoints on the target, in a single command.
+         *
+         * @param addresses
+         * @param preferredType
+         *
+         * @return
+         *  The installed breakpoints. Breakpoints that could not be installed will be absent.
+         */
+        std::vector<Targets::TargetBreakpoint> setBreakpoints(
+            const std::vector<Targets::TargetMemoryAddress>& addresses,
+            Targets::TargetBreakpoint::Type preferredType = Targets::TargetBreakpoint::Type::HARDWARE
+        ) const;
+
+        /**
+         * Requests the TargetController to remove multiple breakpoints from the target, in a single command.
+         *
+         * @param breakpoints
+         */
+        void removeBreakpoints(const std::vector<Targets::TargetBreakpoint>& breakpoints) const;
+
         /**
          * Retrieves the current program counter value from the target.
          *
@@ -217,6 +269,13 @@ namespace Services
          */
         void disableProgrammingMode() const;
 
+        /**
+         * Fetches the hit/miss statistics of the TargetController's memory and register caches.
+         *
+         * @return
+         */
+        TargetController::Responses::CacheStatistics getCacheStatistics() const;
+
         /**
          * Forces the TargetController to shutdown
          */
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+
+namespace TargetController
+{
+    /**
+     * Hit/miss counters for the TargetController's caches.
+     */
+    struct CacheStatistics
+    {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+
+        /**
+         * The number of bytes that were served from the cache, and were therefore not read from the target.
+         */
+        std::uint64_t bytesSaved = 0;
+    };
+}
@@ -28,14 +28,53 @@ namespace TargetController
             std::chrono::milliseconds timeout,
             std::optional<AtomicSessionIdType> atomicSessionId = std::nullopt
         ) const {
-            using SuccessResponseType = typename CommandType::SuccessResponseType;
+            const auto commandId = this->sendCommand(std::move(command), atomicSessionId);
+            return this->waitForResponse<CommandType>(commandId, timeout);
+        }
 
+        /**
+         * Hands the command over to the TargetController, without waiting for a response.
+         *
+         * The caller must collect the response via CommandManager::waitForResponse(), as the TargetController will
+         * hold on to it until then.
+         *
+         * @param command
+         * @param atomicSessionId
+         *
+         * @return
+         *  The ID of the issued command.
+         */
+        template<class CommandType>
+            requires std::is_base_of_v<Commands::Command, CommandType>
+        Commands::CommandIdType sendCommand(
+            std::unique_ptr<CommandType> command,
+            std::optional<AtomicSessionIdType> atomicSessionId = std::nullopt
+        ) const {
             const auto commandId = command->id;
             Logger::debug(
                 "Issuing " + CommandType::name + " command (ID: " + std::to_string(commandId) + ") to TargetController"
             );
 
             TargetControllerComponent::registerCommand(std::move(command), atomicSessionId);
+            return commandId;
+        }
+
+        /**
+         * Waits for the TargetController to respond to a command that was issued via CommandManager::sendCommand().
+         *
+         * Throws an exception if the TargetController responds with an error, or if we time out.
+         *
+         * @param commandId
+         * @param timeout
+         *
+         * @return
+         */
+        template<class CommandType>
+            requires
+                std::is_base_of_v<Commands::Command, CommandType>
+                && std::is_base_of_v<Responses::Response, typename CommandType::SuccessResponseType>
+        auto waitForResponse(Commands::CommandIdType commandId, std::chrono::milliseconds timeout) const {
+            using SuccessResponseType = typename CommandType::SuccessResponseType;
 
             auto optionalResponse = TargetControllerComponent::waitForResponse(commandId, timeout);
 
@@ -23,6 +23,8 @@ namespace TargetController::Commands
         STEP_TARGET_EXECUTION,
         SET_BREAKPOINT,
         REMOVE_BREAKPOINT,
+        SET_BREAKPOINTS,
+        REMOVE_BREAKPOINTS,
         SET_TARGET_PROGRAM_COUNTER,
         GET_TARGET_PIN_STATES,
         SET_TARGET_PIN_STATE,
@@ -30,5 +32,6 @@ namespace TargetController::Commands
         GET_TARGET_PROGRAM_COUNTER,
         ENABLE_PROGRAMMING_MODE,
         DISABLE_PROGRAMMING_MODE,
+        GET_CACHE_STATISTICS,
     };
 }
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Command.hpp"
+
+#include "src/TargetController/Responses/CacheStatistics.hpp"
+
+namespace TargetController::Commands
+{
+    class GetCacheStatistics: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::CacheStatistics;
+
+        static constexpr CommandType type = CommandType::GET_CACHE_STATISTICS;
+        static const inline std::string name = "GetCacheStatistics";
+
+        [[nodiscard]] CommandType getType() const override {
+            return GetCacheStatistics::type;
+        }
+
+        [[nodiscard]] bool requiresDebugMode() const override {
+            return false;
+        }
+    };
+}
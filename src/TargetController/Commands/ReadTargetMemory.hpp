@@ -23,7 +23,9 @@ namespace TargetController::Commands
         Targets::TargetMemorySize bytes;
 
         /**
-         * Currently, we only cache program memory. This flag has no effect when reading from other memories.
+         * If true, the data will be read from the target, even if it's held in one of the TargetController's caches.
+         *
+         * For memories other than program memory, the stop-epoch cache will be refreshed with the data read.
          */
         bool bypassCache;
 
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <vector>
+
+#include "Command.hpp"
+
+#include "src/Targets/TargetBreakpoint.hpp"
+
+namespace TargetController::Commands
+{
+    class RemoveBreakpoints: public Command
+    {
+    public:
+        static constexpr CommandType type = CommandType::REMOVE_BREAKPOINTS;
+        static const inline std::string name = "RemoveBreakpoints";
+
+        std::vector<Targets::TargetBreakpoint> breakpoints;
+
+        explicit RemoveBreakpoints(const std::vector<Targets::TargetBreakpoint>& breakpoints)
+            : breakpoints(breakpoints)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return RemoveBreakpoints::type;
+        }
+
+        [[nodiscard]] bool requiresStoppedTargetState() const override {
+            return true;
+        }
+    };
+}
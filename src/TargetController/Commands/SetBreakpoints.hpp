@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+
+#include "Command.hpp"
+#include "src/TargetController/Responses/Breakpoints.hpp"
+
+#include "src/Targets/TargetBreakpoint.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+namespace TargetController::Commands
+{
+    class SetBreakpoints: public Command
+    {
+    public:
+        using SuccessResponseType = Responses::Breakpoints;
+
+        static constexpr CommandType type = CommandType::SET_BREAKPOINTS;
+        static const inline std::string name = "SetBreakpoints";
+
+        /**
+         * Byte addresses in program memory.
+         */
+        std::vector<Targets::TargetMemoryAddress> addresses;
+
+        /**
+         * The preferred breakpoint type (HARDWARE/SOFTWARE).
+         *
+         * As with the SetBreakpoint command, the TC will fall back to software breakpoints when it's unable to
+         * allocate hardware breakpoints. All software breakpoints will be set in a single operation, where the
+         * target supports it.
+         *
+         * If some of the breakpoints cannot be installed, the TC will still respond with the breakpoints that were
+         * installed. It's up to the issuer to check the response for any missing breakpoints.
+         */
+        Targets::TargetBreakpoint::Type preferredType;
+
+        SetBreakpoints(
+            const std::vector<Targets::TargetMemoryAddress>& addresses,
+            Targets::TargetBreakpoint::Type preferredType
+        )
+            : addresses(addresses)
+            , preferredType(preferredType)
+        {};
+
+        [[nodiscard]] CommandType getType() const override {
+            return SetBreakpoints::type;
+        }
+
+        [[nodiscard]] bool requiresStoppedTargetState() const override {
+            return true;
+        }
+    };
+}
@@ -26,6 +26,16 @@ namespace TargetController::Commands
             , buffer(buffer)
         {};
 
+        WriteTargetMemory(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemoryBuffer&& buffer
+        )
+            : memoryType(memoryType)
+            , startAddress(startAddress)
+            , buffer(std::move(buffer))
+        {};
+
         [[nodiscard]] CommandType getType() const override {
             return WriteTargetMemory::type;
         }
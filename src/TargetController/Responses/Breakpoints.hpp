@@ -0,0 +1,26 @@
+#pragma once
+
+#include <vector>
+
+#include "Response.hpp"
+
+#include "src/Targets/TargetBreakpoint.hpp"
+
+namespace TargetController::Responses
+{
+    class Breakpoints: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::BREAKPOINTS;
+
+        std::vector<Targets::TargetBreakpoint> breakpoints;
+
+        explicit Breakpoints(std::vector<Targets::TargetBreakpoint>&& breakpoints)
+            : breakpoints(std::move(breakpoints))
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return Breakpoints::type;
+        }
+    };
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <map>
+
+#include "Response.hpp"
+
+#include "src/TargetController/CacheStatistics.hpp"
+#include "src/Targets/TargetMemory.hpp"
+
+namespace TargetController::Responses
+{
+    class CacheStatistics: public Response
+    {
+    public:
+        static constexpr ResponseType type = ResponseType::CACHE_STATISTICS;
+
+        TargetController::CacheStatistics programMemoryCacheStatistics;
+        std::map<Targets::TargetMemoryType, TargetController::CacheStatistics> memoryCacheStatisticsByType;
+        TargetController::CacheStatistics registerCacheStatistics;
+
+        CacheStatistics(
+            const TargetController::CacheStatistics& programMemoryCacheStatistics,
+            const std::map<Targets::TargetMemoryType, TargetController::CacheStatistics>& memoryCacheStatisticsByType,
+            const TargetController::CacheStatistics& registerCacheStatistics
+        )
+            : programMemoryCacheStatistics(programMemoryCacheStatistics)
+            , memoryCacheStatisticsByType(memoryCacheStatisticsByType)
+            , registerCacheStatistics(registerCacheStatistics)
+        {}
+
+        [[nodiscard]] ResponseType getType() const override {
+            return CacheStatistics::type;
+        }
+    };
+}
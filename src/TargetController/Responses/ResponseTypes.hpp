@@ -17,5 +17,7 @@ namespace TargetController::Responses
         TARGET_STACK_POINTER,
         TARGET_PROGRAM_COUNTER,
         BREAKPOINT,
+        BREAKPOINTS,
+        CACHE_STATISTICS,
     };
 }
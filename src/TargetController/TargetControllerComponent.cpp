@@ -12,6 +12,8 @@
 
 #include "src/Exceptions/InvalidConfig.hpp"
 
+#include "src/Targets/Microchip/AVR/AVR8/TargetDescription/TargetDescriptionFileMapping.hpp"
+
 namespace TargetController
 {
     using namespace Targets;
@@ -37,6 +39,8 @@ namespace TargetController
     using Commands::StepTargetExecution;
     using Commands::SetBreakpoint;
     using Commands::RemoveBreakpoint;
+    using Commands::SetBreakpoints;
+    using Commands::RemoveBreakpoints;
     using Commands::SetTargetProgramCounter;
     using Commands::GetTargetPinStates;
     using Commands::SetTargetPinState;
@@ -44,6 +48,7 @@ namespace TargetController
     using Commands::GetTargetProgramCounter;
     using Commands::EnableProgrammingMode;
     using Commands::DisableProgrammingMode;
+    using Commands::GetCacheStatistics;
 
     using Responses::Response;
     using Responses::AtomicSessionId;
@@ -53,6 +58,7 @@ namespace TargetController
     using Responses::TargetStackPointer;
     using Responses::TargetProgramCounter;
     using Responses::Breakpoint;
+    using Responses::Breakpoints;
 
     TargetControllerComponent::TargetControllerComponent(
         const ProjectConfig& projectConfig,
@@ -64,15 +70,23 @@ namespace TargetController
 
     void TargetControllerComponent::run() {
         try {
+            const auto startupTime = std::chrono::steady_clock::now();
             this->startup();
 
             this->setThreadStateAndEmitEvent(ThreadState::READY);
-            Logger::debug("TargetController ready and waiting for events.");
+            Logger::debug(
+                "TargetController ready and waiting for events (start-up took "
+                    + std::to_string(
+                        std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now() - startupTime
+                        ).count()
+                    ) + "ms)."
+            );
 
             while (this->getThreadState() == ThreadState::READY) {
                 this->fireTargetEvents();
 
-                TargetControllerComponent::notifier.waitForNotification(std::chrono::milliseconds(60));
+                TargetControllerComponent::notifier.waitForNotification(this->getTargetStatePollingDelay());
 
                 this->processQueuedCommands();
                 this->eventListener->dispatchCurrentEvents();
@@ -219,6 +233,14 @@ namespace TargetController
             std::bind(&TargetControllerComponent::handleRemoveBreakpoint, this, std::placeholders::_1)
         );
 
+        this->registerCommandHandler<SetBreakpoints>(
+            std::bind(&TargetControllerComponent::handleSetBreakpoints, this, std::placeholders::_1)
+        );
+
+        this->registerCommandHandler<RemoveBreakpoints>(
+            std::bind(&TargetControllerComponent::handleRemoveBreakpoints, this, std::placeholders::_1)
+        );
+
         this->registerCommandHandler<SetTargetProgramCounter>(
             std::bind(&TargetControllerComponent::handleSetProgramCounter, this, std::placeholders::_1)
         );
@@ -247,6 +269,10 @@ namespace TargetController
             std::bind(&TargetControllerComponent::handleDisableProgrammingMode, this, std::placeholders::_1)
         );
 
+        this->registerCommandHandler<GetCacheStatistics>(
+            std::bind(&TargetControllerComponent::handleGetCacheStatistics, this, std::placeholders::_1)
+        );
+
         // Register event handlers
         this->eventListener->registerCallbackForEventType<Events::ShutdownTargetController>(
             std::bind(&TargetControllerComponent::onShutdownTargetControllerEvent, this, std::placeholders::_1)
@@ -289,6 +315,15 @@ namespace TargetController
             // Reject any commands still waiting in the queue
             this->processQueuedCommands();
 
+            if (this->breakDetectionLatency.count > 0) {
+                Logger::debug(
+                    "Target break detection latency - breaks: " + std::to_string(this->breakDetectionLatency.count)
+                        + ", mean: " + std::to_string(
+                            (this->breakDetectionLatency.total / this->breakDetectionLatency.count).count()
+                        ) + "us, max: " + std::to_string(this->breakDetectionLatency.maximum.count()) + "us"
+                );
+            }
+
             this->releaseHardware();
 
         } catch (const std::exception& exception) {
@@ -369,25 +404,17 @@ namespace TargetController
         std::string,
         std::function<std::unique_ptr<Targets::Target>(const TargetConfig&)>
     > TargetControllerComponent::getSupportedTargets() {
-        using Avr8TargetDescriptionFile = Targets::Microchip::Avr::Avr8Bit::TargetDescription::TargetDescriptionFile;
+        using Targets::Microchip::Avr::Avr8Bit::TargetDescription::TargetDescriptionFileMapping;
 
         auto mapping = std::map<std::string, std::function<std::unique_ptr<Targets::Target>(const TargetConfig&)>>();
 
-        // Include all targets from AVR8 target description files
-        const auto avr8PdMapping = Avr8TargetDescriptionFile::getTargetDescriptionMapping();
-
-        for (auto mapIt = avr8PdMapping.begin(); mapIt != avr8PdMapping.end(); ++mapIt) {
-            const auto mappingObject = mapIt.value().toObject();
-            const auto targetName = mappingObject.find("name").value().toString().toLower().toStdString();
+        const auto avr8Constructor = [] (const TargetConfig& targetConfig) -> std::unique_ptr<Targets::Target> {
+            return std::make_unique<Targets::Microchip::Avr::Avr8Bit::Avr8>(targetConfig);
+        };
 
-            if (!mapping.contains(targetName)) {
-                mapping.insert({
-                    targetName,
-                    [targetName] (const TargetConfig& targetConfig) {
-                        return std::make_unique<Targets::Microchip::Avr::Avr8Bit::Avr8>(targetConfig);
-                    }
-                });
-            }
+        // Include all targets from AVR8 target description files
+        for (const auto& mappingEntry : TargetDescriptionFileMapping::entries()) {
+            mapping.emplace(std::string(mappingEntry.id), avr8Constructor);
         }
 
         return mapping;
@@ -655,13 +682,381 @@ namespace TargetController
         return output;
     }
 
+    std::vector<Targets::TargetMemoryAddressRange> TargetControllerComponent::excludeAddressRanges(
+        const Targets::TargetMemoryAddressRange& addressRange,
+        const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges
+    ) {
+        auto output = std::vector<Targets::TargetMemoryAddressRange>();
+        auto nextAddress = static_cast<std::uint64_t>(addressRange.startAddress);
+
+        // The excluded address ranges are ordered by their start address.
+        for (const auto& excludedRange : excludedAddressRanges) {
+            if (excludedRange.endAddress < nextAddress) {
+                continue;
+            }
+
+            if (excludedRange.startAddress > addressRange.endAddress) {
+                break;
+            }
+
+            if (excludedRange.startAddress > nextAddress) {
+                output.emplace_back(
+                    static_cast<Targets::TargetMemoryAddress>(nextAddress),
+                    excludedRange.startAddress - 1
+                );
+            }
+
+            nextAddress = static_cast<std::uint64_t>(excludedRange.endAddress) + 1;
+        }
+
+        if (nextAddress <= addressRange.endAddress) {
+            output.emplace_back(static_cast<Targets::TargetMemoryAddress>(nextAddress), addressRange.endAddress);
+        }
+
+        return output;
+    }
+
+    void TargetControllerComponent::populateProgramMemoryCache(
+        const Targets::TargetMemoryAddressRange& addressRange,
+        const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges
+    ) {
+        using Targets::TargetMemoryAddress;
+        using Targets::TargetMemorySize;
+
+        const auto& targetDescriptor = this->getTargetDescriptor();
+        const auto& memoryDescriptor = targetDescriptor.memoryDescriptorsByType.at(
+            targetDescriptor.programMemoryType
+        );
+
+        const auto memoryStartAddress = static_cast<std::uint64_t>(memoryDescriptor.addressRange.startAddress);
+        const auto memoryEndAddress = static_cast<std::uint64_t>(memoryDescriptor.addressRange.endAddress);
+        const auto pageSize = static_cast<std::uint64_t>(std::max(memoryDescriptor.pageSize.value_or(1), 1U));
+
+        /*
+         * We align the read to page boundaries and extend it by the configured read-ahead. Program memory is usually
+         * read sequentially (by GDB's disassembler, stack unwinder, etc.), so the read-ahead saves us a number of
+         * round trips to the debug tool.
+         */
+        const auto readAhead = static_cast<std::uint64_t>(
+            this->environmentConfig.targetConfig.programMemoryCacheReadAhead
+        );
+
+        const auto alignedStartAddress = memoryStartAddress
+            + (((addressRange.startAddress - memoryStartAddress) / pageSize) * pageSize);
+        const auto readAheadPages = (readAhead + pageSize - 1) / pageSize;
+        const auto alignedEndAddress = std::min(
+            memoryStartAddress
+                + ((((addressRange.endAddress - memoryStartAddress) / pageSize) + 1 + readAheadPages) * pageSize) - 1,
+            memoryEndAddress
+        );
+
+        const auto readAndInsert = [this, &targetDescriptor, &excludedAddressRanges] (
+            std::uint64_t startAddress,
+            std::uint64_t endAddress
+        ) {
+            const auto readRange = Targets::TargetMemoryAddressRange(
+                static_cast<TargetMemoryAddress>(startAddress),
+                static_cast<TargetMemoryAddress>(endAddress)
+            );
+
+            const auto data = this->target->readMemory(
+                targetDescriptor.programMemoryType,
+                readRange.startAddress,
+                static_cast<TargetMemorySize>(endAddress - startAddress + 1),
+                excludedAddressRanges
+            );
+
+            // Only the data at non-excluded addresses is inserted into the cache
+            for (const auto& accessibleRange : TargetControllerComponent::excludeAddressRanges(
+                readRange,
+                excludedAddressRanges
+            )) {
+                this->programMemoryCache->insert(
+                    accessibleRange.startAddress,
+                    std::span(data).subspan(
+                        accessibleRange.startAddress - readRange.startAddress,
+                        accessibleRange.endAddress - accessibleRange.startAddress + 1
+                    )
+                );
+            }
+        };
+
+        // Read all contiguous runs of pages that are not already in the cache
+        auto runStartAddress = std::optional<std::uint64_t>();
+
+        for (auto pageAddress = alignedStartAddress; pageAddress <= alignedEndAddress; pageAddress += pageSize) {
+            const auto pageEndAddress = std::min(pageAddress + pageSize - 1, alignedEndAddress);
+            const auto cached = this->programMemoryCache->contains(
+                static_cast<TargetMemoryAddress>(pageAddress),
+                static_cast<TargetMemorySize>(pageEndAddress - pageAddress + 1)
+            );
+
+            if (!cached && !runStartAddress.has_value()) {
+                runStartAddress = pageAddress;
+
+            } else if (cached && runStartAddress.has_value()) {
+                readAndInsert(*runStartAddress, pageAddress - 1);
+                runStartAddress.reset();
+            }
+        }
+
+        if (runStartAddress.has_value()) {
+            readAndInsert(*runStartAddress, alignedEndAddress);
+        }
+    }
+
+    void TargetControllerComponent::maskExcludedAddressRanges(
+        Targets::TargetMemoryBuffer& buffer,
+        Targets::TargetMemoryAddress startAddress,
+        const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges
+    ) {
+        if (buffer.empty()) {
+            return;
+        }
+
+        const auto bufferRange = Targets::TargetMemoryAddressRange(
+            startAddress,
+            static_cast<Targets::TargetMemoryAddress>(startAddress + buffer.size() - 1)
+        );
+
+        for (const auto& excludedRange : excludedAddressRanges) {
+            if (!excludedRange.intersectsWith(bufferRange)) {
+                continue;
+            }
+
+            const auto maskStartAddress = std::max(excludedRange.startAddress, bufferRange.startAddress);
+            const auto maskEndAddress = std::min(excludedRange.endAddress, bufferRange.endAddress);
+
+            std::fill(
+                buffer.begin() + (maskStartAddress - startAddress),
+                buffer.begin() + (maskEndAddress - startAddress) + 1,
+                0x00
+            );
+        }
+    }
+
+    bool TargetControllerComponent::stopEpochCachesEnabled() const {
+        return this->environmentConfig.targetConfig.stopEpochCache && this->lastTargetState == TargetState::STOPPED;
+    }
+
+    Targets::TargetMemoryBuffer TargetControllerComponent::readMemoryViaStopEpochCache(
+        Targets::TargetMemoryType memoryType,
+        Targets::TargetMemoryAddress startAddress,
+        Targets::TargetMemorySize bytes,
+        bool bypassCache,
+        const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges
+    ) {
+        const auto& targetDescriptor = this->getTargetDescriptor();
+        const auto memoryDescriptorIt = targetDescriptor.memoryDescriptorsByType.find(memoryType);
+
+        const auto requestedRange = Targets::TargetMemoryAddressRange(
+            startAddress,
+            static_cast<Targets::TargetMemoryAddress>(startAddress + bytes - 1)
+        );
+
+        if (
+            memoryDescriptorIt == targetDescriptor.memoryDescriptorsByType.end()
+            || !memoryDescriptorIt->second.addressRange.contains(requestedRange.startAddress)
+            || !memoryDescriptorIt->second.addressRange.contains(requestedRange.endAddress)
+            || requestedRange.endAddress < requestedRange.startAddress
+        ) {
+            // We can only cache reads that fall within a known memory segment
+            return this->target->readMemory(memoryType, startAddress, bytes, excludedAddressRanges);
+        }
+
+        auto& cache = this->stopEpochMemoryCaches.try_emplace(memoryType, memoryDescriptorIt->second).first->second;
+        auto& statistics = this->memoryCacheStatisticsByType[memoryType];
+
+        /*
+         * Memory-mapped peripheral registers can be changed by the hardware whilst the target is stopped (some
+         * peripherals keep running), so we never serve them from the cache, nor do we cache them. Reads that span
+         * peripheral registers are always serviced by the target.
+         */
+        auto uncacheableRanges = excludedAddressRanges;
+        auto touchesPeripheralRegisters = false;
+
+        const auto registerAddressRangeIt = this->registerAddressRangeByMemoryType.find(memoryType);
+        if (
+            registerAddressRangeIt != this->registerAddressRangeByMemoryType.end()
+            && registerAddressRangeIt->second.intersectsWith(requestedRange)
+        ) {
+            uncacheableRanges.insert(registerAddressRangeIt->second);
+            touchesPeripheralRegisters = true;
+        }
+
+        const auto accessibleRanges = TargetControllerComponent::excludeAddressRanges(
+            requestedRange,
+            uncacheableRanges
+        );
+
+        if (
+            !bypassCache
+            && !touchesPeripheralRegisters
+            && std::all_of(
+                accessibleRanges.begin(),
+                accessibleRanges.end(),
+                [&cache] (const Targets::TargetMemoryAddressRange& accessibleRange) {
+                    return cache.contains(
+                        accessibleRange.startAddress,
+                        accessibleRange.endAddress - accessibleRange.startAddress + 1
+                    );
+                }
+            )
+        ) {
+            statistics.hits++;
+            statistics.bytesSaved += bytes;
+
+            const auto cachedData = cache.fetch(startAddress, bytes);
+            auto data = Targets::TargetMemoryBuffer(cachedData.begin(), cachedData.end());
+            TargetControllerComponent::maskExcludedAddressRanges(data, startAddress, excludedAddressRanges);
+
+            return data;
+        }
+
+        statistics.misses++;
+
+        auto data = this->target->readMemory(memoryType, startAddress, bytes, excludedAddressRanges);
+
+        for (const auto& accessibleRange : accessibleRanges) {
+            cache.insert(
+                accessibleRange.startAddress,
+                std::span(data).subspan(
+                    accessibleRange.startAddress - startAddress,
+                    accessibleRange.endAddress - accessibleRange.startAddress + 1
+                )
+            );
+        }
+
+        return data;
+    }
+
+    void TargetControllerComponent::updateStopEpochCaches(
+        Targets::TargetMemoryType memoryType,
+        Targets::TargetMemoryAddress startAddress,
+        const Targets::TargetMemoryBuffer& buffer
+    ) {
+        if (buffer.empty()) {
+            return;
+        }
+
+        const auto writtenRange = Targets::TargetMemoryAddressRange(
+            startAddress,
+            static_cast<Targets::TargetMemoryAddress>(startAddress + buffer.size() - 1)
+        );
+
+        const auto registerAddressRangeIt = this->registerAddressRangeByMemoryType.find(memoryType);
+        if (
+            registerAddressRangeIt != this->registerAddressRangeByMemoryType.end()
+            && registerAddressRangeIt->second.intersectsWith(writtenRange)
+        ) {
+            /*
+             * Writing to a peripheral register can have side effects on other registers (clearing flags, toggling
+             * port outputs, etc). We can't predict these, so we discard everything.
+             */
+            this->clearStopEpochCaches();
+            return;
+        }
+
+        const auto memoryCacheIt = this->stopEpochMemoryCaches.find(memoryType);
+        if (memoryCacheIt != this->stopEpochMemoryCaches.end()) {
+            memoryCacheIt->second.insert(startAddress, buffer);
+        }
+    }
+
+    void TargetControllerComponent::updateStopEpochCaches(const Targets::TargetRegisters& registers) {
+        const auto& registerDescriptors = this->getTargetDescriptor().registerDescriptorsById;
+
+        for (const auto& targetRegister : registers) {
+            const auto descriptorIt = registerDescriptors.find(targetRegister.descriptorId);
+            if (descriptorIt == registerDescriptors.end()) {
+                this->clearStopEpochCaches();
+                return;
+            }
+
+            const auto& descriptor = descriptorIt->second;
+
+            if (!this->isStopEpochCacheableRegister(targetRegister.descriptorId)) {
+                // Peripheral register writes can have side effects - see updateStopEpochCaches() above
+                this->clearStopEpochCaches();
+                return;
+            }
+
+            // Values smaller than the register are padded with 0x00 (most significant bytes), by the target
+            auto value = targetRegister.value;
+            if (value.size() < descriptor.size) {
+                value.insert(value.begin(), descriptor.size - value.size(), 0x00);
+            }
+
+            this->stopEpochRegisterCache[targetRegister.descriptorId] = std::move(value);
+
+            if (descriptor.startAddress.has_value()) {
+                const auto memoryCacheIt = this->stopEpochMemoryCaches.find(descriptor.memoryType);
+                if (memoryCacheIt != this->stopEpochMemoryCaches.end()) {
+                    // The byte order of registers in memory is target specific, so we invalidate rather than update
+                    memoryCacheIt->second.invalidate(*(descriptor.startAddress), descriptor.size);
+                }
+            }
+        }
+    }
+
+    bool TargetControllerComponent::isStopEpochCacheableRegister(
+        Targets::TargetRegisterDescriptorId descriptorId
+    ) {
+        using Targets::TargetRegisterType;
+
+        const auto& registerDescriptors = this->getTargetDescriptor().registerDescriptorsById;
+        const auto descriptorIt = registerDescriptors.find(descriptorId);
+
+        if (descriptorIt == registerDescriptors.end()) {
+            return false;
+        }
+
+        const auto& type = descriptorIt->second.type;
+        return type == TargetRegisterType::GENERAL_PURPOSE_REGISTER
+            || type == TargetRegisterType::PROGRAM_COUNTER
+            || type == TargetRegisterType::STACK_POINTER
+            || type == TargetRegisterType::STATUS_REGISTER;
+    }
+
+    void TargetControllerComponent::clearStopEpochCaches() {
+        for (auto& [memoryType, cache] : this->stopEpochMemoryCaches) {
+            cache.clear();
+        }
+
+        this->stopEpochRegisterCache.clear();
+    }
+
     void TargetControllerComponent::fireTargetEvents() {
+        using std::chrono::steady_clock;
+        using std::chrono::microseconds;
+
         auto newTargetState = this->target->getState();
+        const auto now = steady_clock::now();
+
+        if (newTargetState == TargetState::STOPPED) {
+            this->targetRunningSince = std::nullopt;
+
+        } else if (!this->targetRunningSince.has_value()) {
+            this->targetRunningSince = now;
+        }
 
         if (newTargetState != this->lastTargetState) {
             this->lastTargetState = newTargetState;
+            this->clearStopEpochCaches();
 
             if (newTargetState == TargetState::STOPPED) {
+                if (this->lastRunningTargetStatePollTime.has_value()) {
+                    const auto latency = std::chrono::duration_cast<microseconds>(
+                        now - *(this->lastRunningTargetStatePollTime)
+                    );
+
+                    this->breakDetectionLatency.count++;
+                    this->breakDetectionLatency.total += latency;
+                    this->breakDetectionLatency.maximum = std::max(this->breakDetectionLatency.maximum, latency);
+
+                    Logger::debug("Target break detected within " + std::to_string(latency.count()) + "us");
+                }
+
                 Logger::debug("Target state changed - STOPPED");
                 EventManager::triggerEvent(std::make_shared<TargetExecutionStopped>(
                     this->target->getProgramCounter(),
@@ -674,9 +1069,36 @@ namespace TargetController
                 EventManager::triggerEvent(std::make_shared<TargetExecutionResumed>(false));
             }
         }
+
+        this->lastRunningTargetStatePollTime = newTargetState == TargetState::RUNNING
+            ? std::optional(now)
+            : std::nullopt;
+    }
+
+    std::optional<std::chrono::milliseconds> TargetControllerComponent::getTargetStatePollingDelay() const {
+        using std::chrono::milliseconds;
+
+        if (this->lastTargetState == TargetState::STOPPED || !this->targetRunningSince.has_value()) {
+            return std::nullopt;
+        }
+
+        /*
+         * We spend no more than a quarter of the target's running time waiting between polls. So the break
+         * detection latency remains proportionate to the length of the run.
+         */
+        const auto runningFor = std::chrono::duration_cast<milliseconds>(
+            std::chrono::steady_clock::now() - *(this->targetRunningSince)
+        );
+
+        return std::clamp(
+            runningFor / 4,
+            milliseconds(1),
+            this->environmentConfig.targetConfig.maximumStatePollingInterval
+        );
     }
 
     void TargetControllerComponent::resetTarget() {
+        this->clearStopEpochCaches();
         this->target->reset();
 
         EventManager::triggerEvent(std::make_shared<Events::TargetReset>());
@@ -684,6 +1106,7 @@ namespace TargetController
 
     void TargetControllerComponent::enableProgrammingMode() {
         Logger::debug("Enabling programming mode");
+        this->clearStopEpochCaches();
         this->target->enableProgrammingMode();
         Logger::warning("Programming mode enabled");
 
@@ -692,6 +1115,7 @@ namespace TargetController
 
     void TargetControllerComponent::disableProgrammingMode() {
         Logger::debug("Disabling programming mode");
+        this->clearStopEpochCaches();
         this->target->disableProgrammingMode();
         Logger::info("Programming mode disabled");
 
@@ -700,8 +1124,14 @@ namespace TargetController
         Logger::info("Restoring breakpoints");
         this->target->stop();
 
-        for (const auto& [address, breakpoint] : this->softwareBreakpointsByAddress) {
-            this->target->setSoftwareBreakpoint(address);
+        if (!this->softwareBreakpointsByAddress.empty()) {
+            auto softwareBreakpointAddresses = std::vector<Targets::TargetMemoryAddress>();
+
+            for (const auto& [address, breakpoint] : this->softwareBreakpointsByAddress) {
+                softwareBreakpointAddresses.push_back(address);
+            }
+
+            this->target->setSoftwareBreakpoints(softwareBreakpointAddresses);
         }
 
         for (const auto& [address, breakpoint] : this->hardwareBreakpointsByAddress) {
@@ -765,6 +1195,7 @@ namespace TargetController
         if (this->target->getState() != TargetState::STOPPED) {
             this->target->stop();
             this->lastTargetState = TargetState::STOPPED;
+            this->clearStopEpochCaches();
         }
 
         EventManager::triggerEvent(std::make_shared<Events::TargetExecutionStopped>(
@@ -783,8 +1214,10 @@ namespace TargetController
                 this->target->setProgramCounter(*command.fromAddress);
             }
 
+            this->clearStopEpochCaches();
             this->target->run(command.toAddress);
             this->lastTargetState = TargetState::RUNNING;
+            this->targetRunningSince = std::chrono::steady_clock::now();
         }
 
         EventManager::triggerEvent(std::make_shared<Events::TargetExecutionResumed>(false));
@@ -800,16 +1233,49 @@ namespace TargetController
     std::unique_ptr<TargetRegistersRead> TargetControllerComponent::handleReadTargetRegisters(
         ReadTargetRegisters& command
     ) {
-        return std::make_unique<TargetRegistersRead>(
-            !command.descriptorIds.empty()
-                ? this->target->readRegisters(command.descriptorIds)
-                : Targets::TargetRegisters()
-        );
+        if (command.descriptorIds.empty()) {
+            return std::make_unique<TargetRegistersRead>(Targets::TargetRegisters());
+        }
+
+        if (!this->stopEpochCachesEnabled()) {
+            return std::make_unique<TargetRegistersRead>(this->target->readRegisters(command.descriptorIds));
+        }
+
+        auto registers = Targets::TargetRegisters();
+        auto uncachedDescriptorIds = Targets::TargetRegisterDescriptorIds();
+
+        for (const auto& descriptorId : command.descriptorIds) {
+            const auto cachedValueIt = this->stopEpochRegisterCache.find(descriptorId);
+
+            if (cachedValueIt == this->stopEpochRegisterCache.end()) {
+                uncachedDescriptorIds.insert(descriptorId);
+                continue;
+            }
+
+            registers.emplace_back(descriptorId, cachedValueIt->second);
+            this->registerCacheStatistics.hits++;
+            this->registerCacheStatistics.bytesSaved += cachedValueIt->second.size();
+        }
+
+        if (!uncachedDescriptorIds.empty()) {
+            this->registerCacheStatistics.misses += uncachedDescriptorIds.size();
+
+            for (auto& targetRegister : this->target->readRegisters(uncachedDescriptorIds)) {
+                if (this->isStopEpochCacheableRegister(targetRegister.descriptorId)) {
+                    this->stopEpochRegisterCache[targetRegister.descriptorId] = targetRegister.value;
+                }
+
+                registers.emplace_back(std::move(targetRegister));
+            }
+        }
+
+        return std::make_unique<TargetRegistersRead>(std::move(registers));
     }
 
     std::unique_ptr<Response> TargetControllerComponent::handleWriteTargetRegisters(WriteTargetRegisters& command) {
         if (!command.registers.empty()) {
             this->target->writeRegisters(command.registers);
+            this->updateStopEpochCaches(command.registers);
         }
 
         auto registersWrittenEvent = std::make_shared<Events::RegistersWrittenToTarget>();
@@ -821,6 +1287,10 @@ namespace TargetController
     }
 
     std::unique_ptr<TargetMemoryRead> TargetControllerComponent::handleReadTargetMemory(ReadTargetMemory& command) {
+        if (command.bytes == 0) {
+            return std::make_unique<TargetMemoryRead>(Targets::TargetMemoryBuffer());
+        }
+
         const auto& targetDescriptor = this->getTargetDescriptor();
         if (
             command.memoryType == targetDescriptor.programMemoryType
@@ -829,44 +1299,76 @@ namespace TargetController
         ) {
             assert(this->programMemoryCache);
 
+            const auto requestedRange = Targets::TargetMemoryAddressRange(
+                command.startAddress,
+                command.startAddress + command.bytes - 1
+            );
+
+            const auto accessibleRanges = TargetControllerComponent::excludeAddressRanges(
+                requestedRange,
+                command.excludedAddressRanges
+            );
+
+            const auto cached = std::all_of(
+                accessibleRanges.begin(),
+                accessibleRanges.end(),
+                [this] (const Targets::TargetMemoryAddressRange& accessibleRange) {
+                    return this->programMemoryCache->contains(
+                        accessibleRange.startAddress,
+                        accessibleRange.endAddress - accessibleRange.startAddress + 1
+                    );
+                }
+            );
+
+            if (cached) {
+                this->programMemoryCacheStatistics.hits++;
+                this->programMemoryCacheStatistics.bytesSaved += command.bytes;
 
-            if (!this->programMemoryCache->contains(command.startAddress, command.bytes)) {
+            } else {
                 Logger::debug(
                     "Program memory cache miss at 0x" + Services::StringService::toHex(command.startAddress) + ", "
                         + std::to_string(command.bytes) + " bytes"
                 );
 
-                /*
-                 * TODO: We're currently ignoring command.excludedAddressRanges when populating the program
-                 *       memory cache. This isn't a big deal, so I'll sort it later.
-                 */
-                this->programMemoryCache->insert(
-                    command.startAddress,
-                    this->target->readMemory(
-                        command.memoryType,
-                        command.startAddress,
-                        std::max(
-                            command.bytes,
-                            targetDescriptor.memoryDescriptorsByType.at(command.memoryType).pageSize.value_or(0)
-                        )
-                    )
-                );
+                this->programMemoryCacheStatistics.misses++;
+                this->populateProgramMemoryCache(requestedRange, command.excludedAddressRanges);
             }
 
-            return std::make_unique<TargetMemoryRead>(
-                this->programMemoryCache->fetch(command.startAddress, command.bytes)
+            const auto cachedData = this->programMemoryCache->fetch(command.startAddress, command.bytes);
+            auto data = Targets::TargetMemoryBuffer(cachedData.begin(), cachedData.end());
+
+            /*
+             * The cache may hold data at excluded addresses (from previous reads that didn't exclude them). We mask
+             * that data here, in the same way the target driver would.
+             */
+            TargetControllerComponent::maskExcludedAddressRanges(
+                data,
+                command.startAddress,
+                command.excludedAddressRanges
             );
+
+            return std::make_unique<TargetMemoryRead>(std::move(data));
         }
 
-        return std::make_unique<TargetMemoryRead>(
-            command.bytes > 0
-                ? this->target->readMemory(
+        if (command.memoryType != targetDescriptor.programMemoryType && this->stopEpochCachesEnabled()) {
+            return std::make_unique<TargetMemoryRead>(
+                this->readMemoryViaStopEpochCache(
                     command.memoryType,
                     command.startAddress,
                     command.bytes,
+                    command.bypassCache,
                     command.excludedAddressRanges
                 )
-                : Targets::TargetMemoryBuffer()
+            );
+        }
+
+        return std::make_unique<TargetMemoryRead>(
+            this->target->readMemory(
+                command.memoryType,
+                command.startAddress,
+                command.bytes,
+                command.excludedAddressRanges
+            )
         );
     }
 
@@ -882,6 +1384,7 @@ namespace TargetController
         }
 
         this->target->writeMemory(command.memoryType, bufferStartAddress, buffer);
+        this->updateStopEpochCaches(command.memoryType, bufferStartAddress, buffer);
 
         if (
             command.memoryType == targetDescriptor.programMemoryType
@@ -952,6 +1455,11 @@ namespace TargetController
 
         this->target->eraseMemory(command.memoryType);
 
+        const auto memoryCacheIt = this->stopEpochMemoryCaches.find(command.memoryType);
+        if (memoryCacheIt != this->stopEpochMemoryCaches.end()) {
+            memoryCacheIt->second.clear();
+        }
+
         return std::make_unique<Response>();
     }
 
@@ -960,8 +1468,10 @@ namespace TargetController
             this->target->setProgramCounter(command.fromProgramCounter.value());
         }
 
+        this->clearStopEpochCaches();
         this->target->step();
         this->lastTargetState = TargetState::RUNNING;
+        this->targetRunningSince = std::chrono::steady_clock::now();
         EventManager::triggerEvent(std::make_shared<Events::TargetExecutionResumed>(true));
 
         return std::make_unique<Response>();
@@ -1041,8 +1551,141 @@ namespace TargetController
         return std::make_unique<Response>();
     }
 
+    std::unique_ptr<Breakpoints> TargetControllerComponent::handleSetBreakpoints(SetBreakpoints& command) {
+        using Targets::TargetBreakpoint;
+        using Services::StringService;
+
+        auto breakpoints = std::vector<TargetBreakpoint>();
+        auto softwareBreakpointAddresses = std::vector<Targets::TargetMemoryAddress>();
+
+        const auto& targetBreakpointResources = this->getTargetDescriptor().breakpointResources;
+        const auto useHardwareBreakpoints = command.preferredType == TargetBreakpoint::Type::HARDWARE
+            && this->environmentConfig.targetConfig.hardwareBreakpoints;
+
+        static auto exhaustedResourcesWarning = true;
+
+        for (const auto& address : command.addresses) {
+            if (
+                useHardwareBreakpoints
+                && (
+                    !targetBreakpointResources.maximumHardwareBreakpoints.has_value()
+                    || this->hardwareBreakpointsByAddress.size() < (
+                        *(targetBreakpointResources.maximumHardwareBreakpoints)
+                        - targetBreakpointResources.reservedHardwareBreakpoints
+                    )
+                )
+            ) {
+                exhaustedResourcesWarning = true;
+
+                Logger::debug("Installing hardware breakpoint at byte address 0x" + StringService::toHex(address));
+
+                try {
+                    this->target->setHardwareBreakpoint(address);
+
+                } catch (const DeviceFailure&) {
+                    throw;
+
+                } catch (const Exception& exception) {
+                    /*
+                     * We don't throw here, as we may have already installed some of the breakpoints - the caller
+                     * needs to know which ones. Breakpoints that could not be installed are omitted from the response.
+                     */
+                    Logger::error(
+                        "Failed to install hardware breakpoint at byte address 0x" + StringService::toHex(address)
+                            + " - " + exception.getMessage()
+                    );
+                    continue;
+                }
+
+                const auto breakpoint = TargetBreakpoint(address, TargetBreakpoint::Type::HARDWARE);
+                this->hardwareBreakpointsByAddress.insert(std::pair(address, breakpoint));
+                breakpoints.push_back(breakpoint);
+                continue;
+            }
+
+            softwareBreakpointAddresses.push_back(address);
+        }
+
+        if (softwareBreakpointAddresses.empty()) {
+            return std::make_unique<Breakpoints>(std::move(breakpoints));
+        }
+
+        if (useHardwareBreakpoints && exhaustedResourcesWarning) {
+            exhaustedResourcesWarning = false;
+            Logger::warning("Hardware breakpoint resources have been exhausted. Falling back to software breakpoints");
+        }
+
+        Logger::debug("Installing " + std::to_string(softwareBreakpointAddresses.size()) + " software breakpoint(s)");
+
+        try {
+            // All software breakpoints are installed in a single operation, where the target supports it
+            this->target->setSoftwareBreakpoints(softwareBreakpointAddresses);
+
+        } catch (const DeviceFailure&) {
+            throw;
+
+        } catch (const Exception& exception) {
+            // As above, we report the breakpoints that we did manage to install
+            Logger::error("Failed to install software breakpoints - " + exception.getMessage());
+            return std::make_unique<Breakpoints>(std::move(breakpoints));
+        }
+
+        for (const auto& address : softwareBreakpointAddresses) {
+            const auto breakpoint = TargetBreakpoint(address, TargetBreakpoint::Type::SOFTWARE);
+            this->softwareBreakpointsByAddress.insert(std::pair(address, breakpoint));
+            breakpoints.push_back(breakpoint);
+        }
+
+        return std::make_unique<Breakpoints>(std::move(breakpoints));
+    }
+
+    std::unique_ptr<Response> TargetControllerComponent::handleRemoveBreakpoints(RemoveBreakpoints& command) {
+        using Services::StringService;
+
+        auto softwareBreakpointAddresses = std::vector<Targets::TargetMemoryAddress>();
+
+        for (const auto& breakpoint : command.breakpoints) {
+            if (breakpoint.type == Targets::TargetBreakpoint::Type::HARDWARE) {
+                assert(this->environmentConfig.targetConfig.hardwareBreakpoints);
+
+                Logger::debug(
+                    "Removing hardware breakpoint at byte address 0x" + StringService::toHex(breakpoint.address)
+                );
+
+                this->target->removeHardwareBreakpoint(breakpoint.address);
+                this->hardwareBreakpointsByAddress.erase(breakpoint.address);
+                continue;
+            }
+
+            softwareBreakpointAddresses.push_back(breakpoint.address);
+        }
+
+        if (softwareBreakpointAddresses.empty()) {
+            return std::make_unique<Response>();
+        }
+
+        Logger::debug("Removing " + std::to_string(softwareBreakpointAddresses.size()) + " software breakpoint(s)");
+
+        this->target->removeSoftwareBreakpoints(softwareBreakpointAddresses);
+
+        for (const auto& address : softwareBreakpointAddresses) {
+            this->softwareBreakpointsByAddress.erase(address);
+        }
+
+        return std::make_unique<Response>();
+    }
+
     std::unique_ptr<Response> TargetControllerComponent::handleSetProgramCounter(SetTargetProgramCounter& command) {
         this->target->setProgramCounter(command.address);
+
+        std::erase_if(this->stopEpochRegisterCache, [this] (const auto& cacheEntry) {
+            const auto& registerDescriptors = this->getTargetDescriptor().registerDescriptorsById;
+            const auto descriptorIt = registerDescriptors.find(cacheEntry.first);
+
+            return descriptorIt == registerDescriptors.end()
+                || descriptorIt->second.type == Targets::TargetRegisterType::PROGRAM_COUNTER;
+        });
+
         return std::make_unique<Response>();
     }
 
@@ -1052,6 +1695,10 @@ namespace TargetController
 
     std::unique_ptr<Response> TargetControllerComponent::handleSetTargetPinState(SetTargetPinState& command) {
         this->target->setPinState(command.pinDescriptor, command.pinState);
+
+        // Pin states are set via the target's port registers
+        this->clearStopEpochCaches();
+
         return std::make_unique<Response>();
     }
 
@@ -1082,4 +1729,14 @@ namespace TargetController
 
         return std::make_unique<Response>();
     }
+
+    std::unique_ptr<Responses::CacheStatistics> TargetControllerComponent::handleGetCacheStatistics(
+        GetCacheStatistics& command
+    ) {
+        return std::make_unique<Responses::CacheStatistics>(
+            this->programMemoryCacheStatistics,
+            this->memoryCacheStatisticsByType,
+            this->registerCacheStatistics
+        );
+    }
 }
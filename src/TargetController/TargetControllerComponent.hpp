@@ -9,6 +9,8 @@
 #include <map>
 #include <string>
 #include <functional>
+#include <vector>
+#include <set>
 #include <QJsonObject>
 #include <QJsonArray>
 
@@ -18,6 +20,7 @@
 
 #include "TargetControllerState.hpp"
 #include "AtomicSession.hpp"
+#include "CacheStatistics.hpp"
 
 // Commands
 #include "Commands/Command.hpp"
@@ -37,6 +40,8 @@
 #include "Commands/StepTargetExecution.hpp"
 #include "Commands/SetBreakpoint.hpp"
 #include "Commands/RemoveBreakpoint.hpp"
+#include "Commands/SetBreakpoints.hpp"
+#include "Commands/RemoveBreakpoints.hpp"
 #include "Commands/SetTargetProgramCounter.hpp"
 #include "Commands/GetTargetPinStates.hpp"
 #include "Commands/SetTargetPinState.hpp"
@@ -44,6 +49,7 @@
 #include "Commands/GetTargetProgramCounter.hpp"
 #include "Commands/EnableProgrammingMode.hpp"
 #include "Commands/DisableProgrammingMode.hpp"
+#include "Commands/GetCacheStatistics.hpp"
 
 // Responses
 #include "Responses/Response.hpp"
@@ -56,6 +62,8 @@
 #include "Responses/TargetStackPointer.hpp"
 #include "Responses/TargetProgramCounter.hpp"
 #include "Responses/Breakpoint.hpp"
+#include "Responses/Breakpoints.hpp"
+#include "Responses/CacheStatistics.hpp"
 
 #include "src/DebugToolDrivers/DebugTools.hpp"
 #include "src/Targets/Target.hpp"
@@ -151,6 +159,31 @@ namespace TargetController
          */
         Targets::TargetState lastTargetState = Targets::TargetState::UNKNOWN;
 
+        /**
+         * The time at which we first observed the target running, since it was last stopped. Used to determine how
+         * frequently we should poll the target for state changes. See getTargetStatePollingDelay() for more.
+         */
+        std::optional<std::chrono::steady_clock::time_point> targetRunningSince;
+
+        /**
+         * The time of the most recent target state poll that reported the target as running.
+         *
+         * When we detect that the target has stopped, the target must have stopped at some point after this time. So
+         * the time elapsed since this point is the upper bound of the latency between the target halting and the
+         * TargetExecutionStopped event being triggered.
+         */
+        std::optional<std::chrono::steady_clock::time_point> lastRunningTargetStatePollTime;
+
+        /**
+         * Target break detection latency counters. These are logged (at debug level) when the TargetController
+         * shuts down.
+         */
+        struct {
+            std::uint64_t count = 0;
+            std::chrono::microseconds total = std::chrono::microseconds(0);
+            std::chrono::microseconds maximum = std::chrono::microseconds(0);
+        } breakDetectionLatency;
+
         /**
          * Target descriptor cache.
          */
@@ -182,6 +215,31 @@ namespace TargetController
          */
         std::unique_ptr<Targets::TargetMemoryCache> programMemoryCache = nullptr;
 
+        /**
+         * Stop-epoch caches for the target's other memories (RAM, EEPROM, etc), mapped by memory type.
+         *
+         * Whilst the target is stopped, the CPU cannot change the contents of these memories, but some peripherals
+         * can (they keep running). So we cache what we read from these memories, excluding any memory-mapped
+         * peripheral registers, until the target is resumed, stepped or reset. The caches are updated in place when
+         * we write to the target.
+         *
+         * See TargetControllerComponent::clearStopEpochCaches() for more.
+         */
+        std::map<Targets::TargetMemoryType, Targets::TargetMemoryCache> stopEpochMemoryCaches;
+
+        /**
+         * CPU register values read from (or written to) the target, in the current stop epoch, mapped by register
+         * descriptor ID. See TargetControllerComponent::isStopEpochCacheableRegister().
+         */
+        std::map<Targets::TargetRegisterDescriptorId, Targets::TargetMemoryBuffer> stopEpochRegisterCache;
+
+        /**
+         * Cache statistics, reported via the GetCacheStatistics command.
+         */
+        CacheStatistics programMemoryCacheStatistics;
+        std::map<Targets::TargetMemoryType, CacheStatistics> memoryCacheStatisticsByType;
+        CacheStatistics registerCacheStatistics;
+
         /**
          * Registers a handler function for a particular command type.
          * Only one handler function can be registered per command type.
@@ -301,11 +359,139 @@ namespace TargetController
             Targets::TargetMemoryType memoryType
         );
 
+        /**
+         * Splits the given address range into the subranges that do not intersect with any of the excluded address
+         * ranges.
+         *
+         * @param addressRange
+         * @param excludedAddressRanges
+         *
+         * @return
+         *  The remaining subranges, in ascending order.
+         */
+        static std::vector<Targets::TargetMemoryAddressRange> excludeAddressRanges(
+            const Targets::TargetMemoryAddressRange& addressRange,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges
+        );
+
+        /**
+         * Reads the pages intersecting the given address range (plus any configured read-ahead) from the target, and
+         * inserts them into the program memory cache. Pages that are already cached will not be read.
+         *
+         * Data at excluded addresses will not be inserted into the cache.
+         *
+         * @param addressRange
+         * @param excludedAddressRanges
+         */
+        void populateProgramMemoryCache(
+            const Targets::TargetMemoryAddressRange& addressRange,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges
+        );
+
+        /**
+         * Zero-fills any bytes in the given buffer that reside in any of the excluded address ranges.
+         *
+         * @param buffer
+         * @param startAddress
+         *  The start address of the buffer.
+         *
+         * @param excludedAddressRanges
+         */
+        static void maskExcludedAddressRanges(
+            Targets::TargetMemoryBuffer& buffer,
+            Targets::TargetMemoryAddress startAddress,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges
+        );
+
+        /**
+         * Checks if the stop-epoch caches can be used to service the current request.
+         *
+         * @return
+         */
+        bool stopEpochCachesEnabled() const;
+
+        /**
+         * Reads memory from the target, via the stop-epoch cache for the given memory type.
+         *
+         * @param memoryType
+         * @param startAddress
+         * @param bytes
+         * @param bypassCache
+         *  If true, the data will be read from the target, and the cache will be refreshed with it.
+         *
+         * @param excludedAddressRanges
+         *
+         * @return
+         */
+        Targets::TargetMemoryBuffer readMemoryViaStopEpochCache(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            Targets::TargetMemorySize bytes,
+            bool bypassCache,
+            const std::set<Targets::TargetMemoryAddressRange>& excludedAddressRanges
+        );
+
+        /**
+         * Updates the stop-epoch caches to reflect a write to the target's memory.
+         *
+         * @param memoryType
+         * @param startAddress
+         * @param buffer
+         */
+        void updateStopEpochCaches(
+            Targets::TargetMemoryType memoryType,
+            Targets::TargetMemoryAddress startAddress,
+            const Targets::TargetMemoryBuffer& buffer
+        );
+
+        /**
+         * Updates the stop-epoch caches to reflect a write to the target's registers.
+         *
+         * @param registers
+         */
+        void updateStopEpochCaches(const Targets::TargetRegisters& registers);
+
+        /**
+         * Checks if the given register's value can be held in the stop-epoch register cache.
+         *
+         * Only the CPU's registers (general purpose registers, program counter, stack pointer and status register)
+         * are cached. Peripheral registers can be changed by the hardware whilst the target is stopped.
+         *
+         * @param descriptorId
+         *
+         * @return
+         */
+        bool isStopEpochCacheableRegister(Targets::TargetRegisterDescriptorId descriptorId);
+
+        /**
+         * Discards the contents of all stop-epoch caches. This must be called whenever the target's memories or
+         * registers may have been changed outside of the TargetController's control (i.e. the target has executed
+         * code, or has been reset).
+         */
+        void clearStopEpochCaches();
+
         /**
          * Should fire any events queued on the target.
          */
         void fireTargetEvents();
 
+        /**
+         * Determines how long the TargetController should wait for commands or events before polling the target for
+         * state changes.
+         *
+         * When the target is stopped, there is nothing to poll for - the target cannot resume execution without our
+         * instruction. In this case, we return std::nullopt and the TargetController will only wake upon receiving a
+         * command or event.
+         *
+         * When the target is running, the delay grows with the time the target has been running, up to the
+         * configured maximum (TargetConfig::maximumStatePollingInterval). This keeps the latency low for short
+         * runs (single steps, range steps, stepping over function calls, etc) without keeping the debug tool busy
+         * when the target has been running for a while.
+         *
+         * @return
+         */
+        std::optional<std::chrono::milliseconds> getTargetStatePollingDelay() const;
+
         /**
          * Triggers a target reset and emits a TargetReset event.
          */
@@ -362,6 +548,8 @@ namespace TargetController
         std::unique_ptr<Responses::Response> handleStepTargetExecution(Commands::StepTargetExecution& command);
         std::unique_ptr<Responses::Breakpoint> handleSetBreakpoint(Commands::SetBreakpoint& command);
         std::unique_ptr<Responses::Response> handleRemoveBreakpoint(Commands::RemoveBreakpoint& command);
+        std::unique_ptr<Responses::Breakpoints> handleSetBreakpoints(Commands::SetBreakpoints& command);
+        std::unique_ptr<Responses::Response> handleRemoveBreakpoints(Commands::RemoveBreakpoints& command);
         std::unique_ptr<Responses::Response> handleSetProgramCounter(Commands::SetTargetProgramCounter& command);
         std::unique_ptr<Responses::TargetPinStates> handleGetTargetPinStates(Commands::GetTargetPinStates& command);
         std::unique_ptr<Responses::Response> handleSetTargetPinState(Commands::SetTargetPinState& command);
@@ -373,5 +561,6 @@ namespace TargetController
         );
         std::unique_ptr<Responses::Response> handleEnableProgrammingMode(Commands::EnableProgrammingMode& command);
         std::unique_ptr<Responses::Response> handleDisableProgrammingMode(Commands::DisableProgrammingMode& command);
+        std::unique_ptr<Responses::CacheStatistics> handleGetCacheStatistics(Commands::GetCacheStatistics& command);
     };
 }
@@ -105,6 +105,7 @@ namespace Targets::Microchip::Avr::Avr8Bit
 
         this->loadTargetRegisterDescriptors();
         this->loadTargetMemoryDescriptors();
+        this->loadGpioRegisterReadRanges();
     }
 
     bool Avr8::supportsDebugTool(DebugTool* debugTool) {
@@ -313,6 +314,14 @@ namespace Targets::Microchip::Avr::Avr8Bit
         this->avr8DebugInterface->clearSoftwareBreakpoint(address);
     }
 
+    void Avr8::setSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) {
+        this->avr8DebugInterface->setSoftwareBreakpoints(addresses);
+    }
+
+    void Avr8::removeSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) {
+        this->avr8DebugInterface->clearSoftwareBreakpoints(addresses);
+    }
+
     void Avr8::setHardwareBreakpoint(TargetMemoryAddress address) {
         this->avr8DebugInterface->setHardwareBreakpoint(address);
     }
@@ -442,30 +451,29 @@ namespace Targets::Microchip::Avr::Avr8Bit
         const auto& variant = targetVariantIt->second;
 
         /*
-         * To prevent the number of memory reads we perform here, we cache the data and map it by start address.
-         *
-         * This way, we only perform 3 memory reads for a target variant with 3 ports - one per port (instead of one
-         * per pin).
-         *
-         * We may be able to make this more efficient by combining reads for ports with aligned memory addresses. This
-         * will be considered when the need for it becomes apparent.
+         * We read all GPIO registers up front, using the ranges resolved at construction (see
+         * Avr8::loadGpioRegisterReadRanges()). This typically amounts to a single read, regardless of the number of
+         * ports on the target.
          */
-        std::map<std::uint16_t, TargetMemoryBuffer> cachedMemoryByStartAddress;
-        const auto readMemoryBitset = [this, &cachedMemoryByStartAddress] (std::uint16_t startAddress) {
-            auto cachedByteIt = cachedMemoryByStartAddress.find(startAddress);
-
-            if (cachedByteIt == cachedMemoryByStartAddress.end()) {
-                cachedByteIt = cachedMemoryByStartAddress.insert(
-                    std::pair(
-                        startAddress,
-                        this->readMemory(TargetMemoryType::RAM, startAddress, 1)
-                    )
-                ).first;
+        auto gpioRegisterValuesByAddress = std::map<std::uint16_t, unsigned char>();
+        for (const auto& readRange : this->gpioRegisterReadRanges) {
+            const auto& addressRange = readRange.addressRange;
+            const auto data = this->readMemory(
+                TargetMemoryType::RAM,
+                addressRange.startAddress,
+                addressRange.endAddress - addressRange.startAddress + 1,
+                readRange.excludedAddressRanges
+            );
+
+            for (auto address = addressRange.startAddress; address <= addressRange.endAddress; ++address) {
+                gpioRegisterValuesByAddress[static_cast<std::uint16_t>(address)] = data.at(
+                    address - addressRange.startAddress
+                );
             }
+        }
 
-            return std::bitset<std::numeric_limits<unsigned char>::digits>(
-                cachedByteIt->second.at(0)
-            );
+        const auto readMemoryBitset = [&gpioRegisterValuesByAddress] (std::uint16_t address) {
+            return std::bitset<std::numeric_limits<unsigned char>::digits>(gpioRegisterValuesByAddress.at(address));
         };
 
         for (const auto& [pinNumber, pinDescriptor] : variant.pinDescriptorsByNumber) {
@@ -675,7 +683,12 @@ namespace Targets::Microchip::Avr::Avr8Bit
                     flashStartAddress + this->targetParameters.flashSize.value() - 1
                 ),
                 TargetMemoryAccess(true, true, false),
-                this->targetParameters.flashPageSize
+                this->targetParameters.flashPageSize,
+                /*
+                 * Flash writes on debugWire targets erase the affected pages. All other targets require a (chip or
+                 * section) erase before the flash can be written to.
+                 */
+                this->targetConfig.physicalInterface != PhysicalInterface::DEBUG_WIRE
             )
         ));
 
@@ -696,6 +709,53 @@ namespace Targets::Microchip::Avr::Avr8Bit
         }
     }
 
+    void Avr8::loadGpioRegisterReadRanges() {
+        /*
+         * Reading the bytes between two GPIO registers costs nothing extra, as they're excluded (masked) from the
+         * read. But very large gaps would result in reads exceeding the debug tool's maximum access size, so we
+         * start a new range when the gap is larger than this.
+         */
+        static constexpr auto MAXIMUM_GAP_SIZE = TargetMemorySize{64};
+
+        auto addresses = std::set<std::uint16_t>();
+        for (const auto& [padName, padDescriptor] : this->padDescriptorsByName) {
+            if (!padDescriptor.gpioPinNumber.has_value()) {
+                continue;
+            }
+
+            for (const auto& address : {
+                padDescriptor.gpioDdrAddress,
+                padDescriptor.gpioPortAddress,
+                padDescriptor.gpioPortInputAddress
+            }) {
+                if (address.has_value()) {
+                    addresses.insert(*address);
+                }
+            }
+        }
+
+        for (const auto address : addresses) {
+            if (!this->gpioRegisterReadRanges.empty()) {
+                auto& lastRange = this->gpioRegisterReadRanges.back();
+                const auto lastAddress = lastRange.addressRange.endAddress;
+
+                if (address <= lastAddress + MAXIMUM_GAP_SIZE + 1) {
+                    if (address > lastAddress + 1) {
+                        lastRange.excludedAddressRanges.emplace(lastAddress + 1, address - 1);
+                    }
+
+                    lastRange.addressRange.endAddress = address;
+                    continue;
+                }
+            }
+
+            this->gpioRegisterReadRanges.emplace_back(GpioRegisterReadRange{
+                .addressRange = TargetMemoryAddressRange(address, address),
+                .excludedAddressRanges = {},
+            });
+        }
+    }
+
     BreakpointResources Avr8::getBreakpointResources() {
         auto maxHardwareBreakpoints = static_cast<std::uint16_t>(0);
 
@@ -4,6 +4,8 @@
 #include <queue>
 #include <utility>
 #include <optional>
+#include <set>
+#include <vector>
 
 #include "src/Targets/Target.hpp"
 #include "src/DebugToolDrivers/DebugTool.hpp"
@@ -61,6 +63,8 @@ namespace Targets::Microchip::Avr::Avr8Bit
 
         void setSoftwareBreakpoint(TargetMemoryAddress address) override;
         void removeSoftwareBreakpoint(TargetMemoryAddress address) override;
+        void setSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) override;
+        void removeSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) override;
 
         void setHardwareBreakpoint(TargetMemoryAddress address) override;
         void removeHardwareBreakpoint(TargetMemoryAddress address) override;
@@ -120,6 +124,24 @@ namespace Targets::Microchip::Avr::Avr8Bit
         std::map<std::string, PadDescriptor> padDescriptorsByName;
         std::map<int, TargetVariant> targetVariantsById;
 
+        /**
+         * A range of GPIO registers to read in a single operation. Bytes that fall between GPIO registers are
+         * excluded from the read, as reading other peripheral registers can have side effects.
+         */
+        struct GpioRegisterReadRange
+        {
+            TargetMemoryAddressRange addressRange;
+            std::set<TargetMemoryAddressRange> excludedAddressRanges;
+        };
+
+        /**
+         * The GPIO registers (DDR, PORT and PIN) of all pads, coalesced into as few ranges as possible, so that
+         * Avr8::getPinStates() can obtain the state of every pin in a small number of reads.
+         *
+         * See Avr8::loadGpioRegisterReadRanges().
+         */
+        std::vector<GpioRegisterReadRange> gpioRegisterReadRanges;
+
         TargetRegisterDescriptor stackPointerRegisterDescriptor;
         TargetRegisterDescriptor statusRegisterDescriptor;
 
@@ -147,6 +169,12 @@ namespace Targets::Microchip::Avr::Avr8Bit
 
         void loadTargetMemoryDescriptors();
 
+        /**
+         * Populates this->gpioRegisterReadRanges with the addresses of the GPIO registers referenced by the pad
+         * descriptors.
+         */
+        void loadGpioRegisterReadRanges();
+
         BreakpointResources getBreakpointResources();
 
         /**
@@ -81,5 +81,27 @@ namespace Targets::Microchip::Avr::Avr8Bit
                 this->reserveSteppingBreakpoint
             );
         }
+
+        if (targetNode["probeMaximumMemoryAccessSize"]) {
+            this->probeMaximumMemoryAccessSize = targetNode["probeMaximumMemoryAccessSize"].as<bool>(
+                this->probeMaximumMemoryAccessSize
+            );
+        }
+
+        if (targetNode["maximumMemoryAccessSize"]) {
+            const auto maximumMemoryAccessSize = targetNode["maximumMemoryAccessSize"].as<std::uint32_t>(0);
+
+            if (maximumMemoryAccessSize == 0) {
+                throw InvalidConfig("Invalid maximumMemoryAccessSize value for AVR8 target - must be greater than 0.");
+            }
+
+            this->maximumMemoryAccessSize = maximumMemoryAccessSize;
+        }
+
+        if (targetNode["pipelineDebugToolCommands"]) {
+            this->pipelineDebugToolCommands = targetNode["pipelineDebugToolCommands"].as<bool>(
+                this->pipelineDebugToolCommands
+            );
+        }
     }
 }
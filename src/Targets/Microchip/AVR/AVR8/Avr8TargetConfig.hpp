@@ -1,6 +1,8 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <map>
 
@@ -98,6 +100,43 @@ namespace Targets::Microchip::Avr::Avr8Bit
          */
         bool reserveSteppingBreakpoint = true;
 
+        /**
+         * Some debug tools can service memory reads that are larger than the conservative limit we impose by default.
+         * When this flag is enabled, Bloom will probe the debug tool upon activation, to determine the largest read
+         * size that yields correct data. The result applies for the remainder of the session. The probe is skipped if
+         * the target's RAM holds no data that would reveal an incorrect read (for example, if it's all zeros).
+         *
+         * NOTE: Currently, this flag is only honoured by the EdbgAvr8Interface.
+         *
+         * This parameter is optional. The function is enabled by default.
+         */
+        bool probeMaximumMemoryAccessSize = true;
+
+        /**
+         * Overrides the maximum number of bytes that will be accessed in a single memory access request. When set,
+         * no probing will take place (see probeMaximumMemoryAccessSize), and the limit will apply to reads and writes.
+         *
+         * NOTE: Currently, this parameter is only honoured by the EdbgAvr8Interface.
+         *
+         * This parameter is optional.
+         */
+        std::optional<std::uint32_t> maximumMemoryAccessSize;
+
+        /**
+         * Some debug tools can buffer multiple command packets. When this flag is enabled, Bloom will query the debug
+         * tool for the number of packets it can buffer, and send commands in batches of up to that many, without
+         * waiting for the response to each command.
+         *
+         * The minimum time gap between commands is only enforced between batches, and some debug tools are known to
+         * misbehave when commands are sent too quickly. This has not been validated on all supported debug tools,
+         * which is why it is opt-in.
+         *
+         * NOTE: Currently, this flag is only honoured by the EdbgAvr8Interface.
+         *
+         * This parameter is optional. The function is disabled by default.
+         */
+        bool pipelineDebugToolCommands = false;
+
         explicit Avr8TargetConfig(const TargetConfig& targetConfig);
 
     private:
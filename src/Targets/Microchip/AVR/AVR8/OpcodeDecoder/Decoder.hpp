@@ -3,10 +3,10 @@
 #include <cstdint>
 #include <map>
 #include <array>
-#include <functional>
 #include <optional>
 
 #include "Instruction.hpp"
+#include "InstructionStream.hpp"
 
 #include "src/Targets/TargetMemory.hpp"
 #include "src/Services/BitsetService.hpp"
@@ -42,15 +42,104 @@ namespace Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder
             bool throwOnFailure = false
         );
 
+        /**
+         * Decodes AVR8 opcodes into an InstructionStream, with one compact record per word.
+         *
+         * This is preferred over Decoder::decode() for large amounts of program memory, as it performs a single
+         * allocation (for the records) regardless of the number of instructions.
+         *
+         * @param startByteAddress
+         *  The start (byte) address of the memory given via the `data` param. Must be word-aligned.
+         *
+         * @param data
+         *  The opcodes to decode, in LSB form. A trailing odd byte will be ignored.
+         *
+         * @return
+         *  The instruction stream. Decode failures are recorded as records without the FLAG_DECODED flag.
+         */
+        static InstructionStream decodeStream(
+            Targets::TargetMemoryAddress startByteAddress,
+            const Targets::TargetMemoryBuffer& data
+        );
+
+        /**
+         * Reconstructs the full Instruction from a record in an InstructionStream, by decoding its opcode again.
+         *
+         * @param record
+         *
+         * @return
+         *  std::nullopt if the record is for a word that we failed to decode, or is the second word of a 32-bit
+         *  instruction.
+         */
+        static std::optional<Instruction> instruction(const CompactInstruction& record);
+
     private:
-        using OpcodeDecoderFunction = std::function<
-            std::optional<Instruction>(
-                const Targets::TargetMemoryBuffer::const_iterator&,
-                const Targets::TargetMemoryBuffer::const_iterator&
-           )
-        >;
-        using OpcodeDecoders = std::array<Decoder::OpcodeDecoderFunction, 145>;
-
-        static OpcodeDecoders opcodeDecoders();
+        /**
+         * The unit tests compare the dispatch table lookup with a linear search of the opcode decoders.
+         */
+        friend class DecoderTest;
+
+        using OpcodeDecoderFunction = std::optional<Instruction>(*)(
+            const Targets::TargetMemoryBuffer::const_iterator&,
+            const Targets::TargetMemoryBuffer::const_iterator&
+        );
+
+        struct OpcodeDecoder
+        {
+            OpcodeDecoderFunction decode;
+
+            /**
+             * See Opcode::firstWordMask() and Opcode::firstWordOpcode().
+             */
+            std::uint16_t firstWordMask;
+            std::uint16_t firstWordOpcode;
+        };
+
+        using OpcodeDecoders = std::array<Decoder::OpcodeDecoder, 145>;
+
+        /**
+         * The dispatch table maps every possible instruction word to the index of the first opcode decoder (in
+         * Decoder::opcodeDecoders()) that could decode an instruction beginning with that word.
+         *
+         * Words that can't begin any instruction map to Decoder::NO_DECODER.
+         */
+        using DispatchTable = std::array<std::uint8_t, 0x10000>;
+
+        static constexpr std::uint8_t NO_DECODER = 0xFF;
+
+        template <typename OpcodeType>
+        static constexpr Decoder::OpcodeDecoder opcodeDecoder();
+
+        static constexpr OpcodeDecoders opcodeDecoders();
+
+        /**
+         * Returns the opcode decoders, in the order in which they should be tried. This is just a non-constexpr
+         * accessor for Decoder::opcodeDecoders(), for use outside of this class's translation unit.
+         *
+         * @return
+         */
+        static const OpcodeDecoders& orderedOpcodeDecoders();
+
+        /**
+         * Generates the dispatch table for the given decoders.
+         *
+         * @param decoders
+         * @return
+         */
+        static constexpr DispatchTable dispatchTable(const OpcodeDecoders& decoders);
+
+        /**
+         * Decodes the single instruction at the beginning of the given data.
+         *
+         * @param dataIt
+         * @param dataEndIt
+         *
+         * @return
+         *  std::nullopt if the data does not begin with a valid instruction.
+         */
+        static std::optional<Instruction> decodeInstruction(
+            const Targets::TargetMemoryBuffer::const_iterator& dataIt,
+            const Targets::TargetMemoryBuffer::const_iterator& dataEndIt
+        );
     };
 }
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Instruction.hpp"
+
+#include "src/Targets/TargetMemory.hpp"
+
+namespace Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder
+{
+    /**
+     * A compact record of a decoded instruction.
+     *
+     * The Instruction struct is too large to hold for entire program memories (one Instruction per word, each
+     * allocated in a map node). CompactInstruction only holds what's needed for control flow analysis, in 12 bytes.
+     * The full Instruction can be obtained via Decoder::instruction(), which decodes the opcode again.
+     */
+    struct CompactInstruction
+    {
+        static constexpr std::uint8_t FLAG_DECODED = 0x01;
+        static constexpr std::uint8_t FLAG_CAN_CHANGE_PROGRAM_FLOW = 0x02;
+        static constexpr std::uint8_t FLAG_CAN_SKIP_NEXT_INSTRUCTION = 0x04;
+        static constexpr std::uint8_t FLAG_HAS_PROGRAM_WORD_ADDRESS = 0x08;
+        static constexpr std::uint8_t FLAG_HAS_PROGRAM_WORD_ADDRESS_OFFSET = 0x10;
+
+        /**
+         * The opcode, in the same form as Instruction::opcode. For words we failed to decode, this is the word
+         * itself.
+         */
+        std::uint32_t opcode = 0;
+
+        /**
+         * Only one of these is valid, depending on the FLAG_HAS_PROGRAM_WORD_ADDRESS* flags.
+         */
+        union
+        {
+            Targets::TargetMemoryAddress programWordAddress = 0;
+            std::int16_t programWordAddressOffset;
+        };
+
+        Instruction::Mnemonic mnemonic = Instruction::Mnemonic::UNDEFINED;
+
+        /**
+         * The size of the instruction, in bytes.
+         *
+         * The second word of a 32-bit instruction has its own record, with a byteSize of 0. Words that we failed to
+         * decode have a byteSize of 2.
+         */
+        std::uint8_t byteSize = 0;
+
+        std::uint8_t flags = 0;
+
+        [[nodiscard]] bool decoded() const {
+            return (this->flags & CompactInstruction::FLAG_DECODED) != 0;
+        }
+
+        [[nodiscard]] bool canChangeProgramFlow() const {
+            return (this->flags & CompactInstruction::FLAG_CAN_CHANGE_PROGRAM_FLOW) != 0;
+        }
+
+        [[nodiscard]] bool canSkipNextInstruction() const {
+            return (this->flags & CompactInstruction::FLAG_CAN_SKIP_NEXT_INSTRUCTION) != 0;
+        }
+
+        [[nodiscard]] bool hasProgramWordAddress() const {
+            return (this->flags & CompactInstruction::FLAG_HAS_PROGRAM_WORD_ADDRESS) != 0;
+        }
+
+        [[nodiscard]] bool hasProgramWordAddressOffset() const {
+            return (this->flags & CompactInstruction::FLAG_HAS_PROGRAM_WORD_ADDRESS_OFFSET) != 0;
+        }
+
+        /**
+         * Returns true if this record is the second word of a 32-bit instruction.
+         */
+        [[nodiscard]] bool isContinuation() const {
+            return this->byteSize == 0;
+        }
+    };
+
+    static_assert(sizeof(CompactInstruction) == 12);
+
+    /**
+     * A contiguous stream of CompactInstruction records, with one record per program memory word.
+     *
+     * Records are indexed by word, so any address can be looked up in constant time, without walking the stream.
+     */
+    struct InstructionStream
+    {
+        /**
+         * The byte address of the first record.
+         */
+        Targets::TargetMemoryAddress startByteAddress = 0;
+
+        std::vector<CompactInstruction> records;
+
+        /**
+         * Returns the byte address immediately after the last record.
+         */
+        [[nodiscard]] Targets::TargetMemoryAddress endByteAddress() const {
+            return this->startByteAddress + static_cast<Targets::TargetMemoryAddress>(this->records.size() * 2);
+        }
+
+        /**
+         * Returns the instruction record at the given byte address.
+         *
+         * @param byteAddress
+         *
+         * @return
+         *  A pointer to the record, or nullptr if the address is outside of the stream, is misaligned, or points to
+         *  the second word of a 32-bit instruction.
+         */
+        [[nodiscard]] const CompactInstruction* find(Targets::TargetMemoryAddress byteAddress) const {
+            if (
+                byteAddress < this->startByteAddress
+                || byteAddress >= this->endByteAddress()
+                || (byteAddress - this->startByteAddress) % 2 != 0
+            ) {
+                return nullptr;
+            }
+
+            const auto& record = this->records[(byteAddress - this->startByteAddress) / 2];
+            return record.isContinuation() ? nullptr : &record;
+        }
+    };
+}
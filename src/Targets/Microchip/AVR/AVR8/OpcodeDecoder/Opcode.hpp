@@ -728,8 +728,30 @@ namespace Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder
             return output;
         }
 
+        /**
+         * Returns a mask of the bits in the first instruction word that are not occupied by parameters.
+         *
+         * For 2-word instructions, the first word holds the 16 most significant bits of the opcode.
+         *
+         * @return
+         */
+        static constexpr std::uint16_t firstWordMask() {
+            return static_cast<std::uint16_t>(SelfType::opcodeMask() >> ((wordSize - 1) * 16));
+        }
+
+        /**
+         * Returns the expected value of the bits in the first instruction word, that are not occupied by parameters.
+         *
+         * An instruction word can only hold this instruction if (word & firstWordMask()) == firstWordOpcode().
+         *
+         * @return
+         */
+        static constexpr std::uint16_t firstWordOpcode() {
+            return static_cast<std::uint16_t>(expectedOpcode >> ((wordSize - 1) * 16));
+        }
+
     private:
-        static OpcodeDataType opcodeMask() {
+        static constexpr OpcodeDataType opcodeMask() {
             using Services::BitsetService;
 
             auto opcodeMask = static_cast<OpcodeDataType>(-1LL);
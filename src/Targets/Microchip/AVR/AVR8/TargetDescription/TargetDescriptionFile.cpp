@@ -1,8 +1,8 @@
 #include "TargetDescriptionFile.hpp"
 
-#include <QJsonDocument>
-#include <QJsonArray>
-#include <QJsonObject>
+#include <memory>
+
+#include "TargetDescriptionFileMapping.hpp"
 
 #include "src/Services/PathService.hpp"
 #include "src/Logger/Logger.hpp"
@@ -23,22 +23,67 @@ namespace Targets::Microchip::Avr::Avr8Bit::TargetDescription
     using Targets::TargetRegisterDescriptor;
 
     TargetDescriptionFile::TargetDescriptionFile(const std::string& targetName) {
-        const auto mapping = TargetDescriptionFile::getTargetDescriptionMapping();
-        const auto descriptionFileObjectIt = mapping.find(QString::fromStdString(targetName).toLower());
+        const auto* mappingEntry = TargetDescriptionFileMapping::find(targetName);
 
-        if (descriptionFileObjectIt == mapping.end()) {
+        if (mappingEntry == nullptr) {
             throw Exception(
                 "Failed to resolve target description file for target \"" + targetName + "\" - unknown target name."
             );
         }
 
-        const auto descriptionFileObject = descriptionFileObjectIt.value().toObject();
-        const auto descriptionFilePath = QString::fromStdString(
-            Services::PathService::resourcesDirPath()) + "/" + descriptionFileObject.find("tdfPath")->toString();
+        const auto loadStartTime = std::chrono::steady_clock::now();
+        const auto descriptionFilePath = Services::PathService::resourcesDirPath() + "/"
+            + std::string(mappingEntry->tdfPath);
+
+        if (!mappingEntry->compiledTdfPath.empty()) {
+            const auto compiledFilePath = Services::PathService::resourcesDirPath() + "/"
+                + std::string(mappingEntry->compiledTdfPath);
+
+            /*
+             * We only fall back to the XML if the compiled TDF can't be opened. Once we've started loading from it,
+             * we can't recover, as we may have already populated some of the members.
+             */
+            auto compiledFile = std::unique_ptr<Targets::TargetDescription::CompiledTargetDescriptionFile>();
+
+            try {
+                compiledFile = std::make_unique<Targets::TargetDescription::CompiledTargetDescriptionFile>(
+                    compiledFilePath
+                );
+
+            } catch (const Exception& exception) {
+                Logger::debug(
+                    "Failed to open compiled AVR8 target description file - " + exception.getMessage()
+                        + " - falling back to XML"
+                );
+            }
+
+            if (compiledFile) {
+                Logger::debug("Loading compiled AVR8 target description file: " + compiledFilePath);
+                this->init(*compiledFile);
+                TargetDescriptionFile::logLoadTime(loadStartTime);
+
+#ifdef BLOOM_DEBUG_BUILD
+                // Catch any discrepancies between the compiled TDF loader and the XML loader
+                this->verifyAgainstXml(QString::fromStdString(descriptionFilePath));
+#endif
+                return;
+            }
+        }
+
+        Logger::debug("Loading AVR8 target description file: " + descriptionFilePath);
 
-        Logger::debug("Loading AVR8 target description file: " + descriptionFilePath.toStdString());
+        Targets::TargetDescription::TargetDescriptionFile::init(QString::fromStdString(descriptionFilePath));
+        TargetDescriptionFile::logLoadTime(loadStartTime);
+    }
 
-        Targets::TargetDescription::TargetDescriptionFile::init(descriptionFilePath);
+    void TargetDescriptionFile::logLoadTime(std::chrono::steady_clock::time_point loadStartTime) {
+        const auto loadDuration = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - loadStartTime
+        );
+
+        Logger::debug(
+            "AVR8 target description file loaded in " + std::to_string(loadDuration.count()) + " microseconds"
+        );
     }
 
     void TargetDescriptionFile::init(const QDomDocument& xml) {
@@ -50,17 +95,13 @@ namespace Targets::Microchip::Avr::Avr8Bit::TargetDescription
         this->loadTargetRegisterDescriptors();
     }
 
-    QJsonObject TargetDescriptionFile::getTargetDescriptionMapping() {
-        auto mappingFile = QFile(
-            QString::fromStdString(Services::PathService::resourcesDirPath() + "/TargetDescriptionFiles/AVR/Mapping.json")
-        );
+    void TargetDescriptionFile::init(const Targets::TargetDescription::CompiledTargetDescriptionFile& compiledFile) {
+        Targets::TargetDescription::TargetDescriptionFile::init(compiledFile);
 
-        if (!mappingFile.exists()) {
-            throw Exception("Failed to load AVR target description mapping - mapping file not found");
-        }
-
-        mappingFile.open(QIODevice::ReadOnly);
-        return QJsonDocument::fromJson(mappingFile.readAll()).object();
+        this->loadSupportedPhysicalInterfaces();
+        this->loadPadDescriptors();
+        this->loadTargetVariants();
+        this->loadTargetRegisterDescriptors();
     }
 
     TargetSignature TargetDescriptionFile::getTargetSignature() const {
@@ -2,6 +2,7 @@
 
 #include <set>
 #include <optional>
+#include <chrono>
 
 #include "src/Targets/TargetDescription/TargetDescriptionFile.hpp"
 
@@ -22,11 +23,11 @@ namespace Targets::Microchip::Avr::Avr8Bit::TargetDescription
     /**
      * Represents an AVR8 TDF. See the Targets::TargetDescription::TargetDescriptionFile close for more on TDFs.
      *
-     * During the build process, we generate a JSON file containing a mapping of AVR8 target signatures to target
-     * description file paths. Bloom uses this mapping to find a particular target description file, for AVR8 targets,
-     * given a target signature. See directory "build/resources/TargetDescriptionFiles".
-     * The generation of the JSON mapping, is done by a PHP script:
-     * "build/scripts/CopyAvrPartFilesAndCreateMapping.php". This script is invoked via a custom command, at build time.
+     * During the build process, we generate a mapping of AVR8 target IDs to target description file paths, which is
+     * compiled into Bloom. Bloom uses this mapping to find a particular target description file, for AVR8 targets,
+     * given a target name. See the TargetDescriptionFileMapping class.
+     * The generation of the mapping is done by a PHP script: "build/scripts/Avr8TargetDescriptionFiles.php". This
+     * script is invoked via a custom command, at build time.
      *
      * For more information of TDFs, see src/Targets/TargetDescription/README.md
      */
@@ -34,7 +35,11 @@ namespace Targets::Microchip::Avr::Avr8Bit::TargetDescription
     {
     public:
         /**
-         * Will resolve the target description file using the target description JSON mapping and a given target name.
+         * Will resolve the target description file using the target description file mapping and a given target name.
+         *
+         * If the mapping provides a compiled TDF for the target (only the case when Bloom was built with the
+         * COMPILE_TARGET_DESCRIPTION_FILES option), we'll load that instead of the XML. We fall back to the XML if the
+         * compiled TDF cannot be loaded (e.g. it was compiled by a different version of Bloom).
          *
          * @param targetName
          */
@@ -49,11 +54,11 @@ namespace Targets::Microchip::Avr::Avr8Bit::TargetDescription
         void init(const QDomDocument& xml) override;
 
         /**
-         * Loads the AVR8 target description JSON mapping file.
+         * Same as TargetDescriptionFile::init(const QDomDocument&), but for compiled TDFs.
          *
-         * @return
+         * @param compiledFile
          */
-        static QJsonObject getTargetDescriptionMapping();
+        void init(const Targets::TargetDescription::CompiledTargetDescriptionFile& compiledFile) override;
 
         /**
          * Extracts the AVR8 target signature from the TDF.
@@ -204,6 +209,14 @@ namespace Targets::Microchip::Avr::Avr8Bit::TargetDescription
 
         std::map<TargetRegisterDescriptorId, TargetRegisterDescriptor> targetRegisterDescriptorsById;
 
+        /**
+         * Logs the time taken to load the TDF, from the given start time. This is used to compare start-up times
+         * for compiled TDFs and XML TDFs.
+         *
+         * @param loadStartTime
+         */
+        static void logLoadTime(std::chrono::steady_clock::time_point loadStartTime);
+
         /**
          * Populates this->supportedPhysicalInterfaces with physical interfaces defined in the TDF.
          */
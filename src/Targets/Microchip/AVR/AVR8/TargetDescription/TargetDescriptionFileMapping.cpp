@@ -0,0 +1,77 @@
+#include "TargetDescriptionFileMapping.hpp"
+
+#include <algorithm>
+
+// Generated at build time - see build/scripts/Avr8TargetDescriptionFiles.php
+#include "Avr8TargetDescriptionFileMapping.generated.hpp"
+
+namespace Targets::Microchip::Avr::Avr8Bit::TargetDescription
+{
+    namespace
+    {
+        constexpr char toLower(char character) {
+            return character >= 'A' && character <= 'Z' ? static_cast<char>(character - 'A' + 'a') : character;
+        }
+
+        /**
+         * Compares a target ID with a target name, ignoring the case of the target name (target IDs are always in
+         * lower case).
+         */
+        constexpr bool idLessThanName(std::string_view id, std::string_view targetName) {
+            return std::lexicographical_compare(
+                id.begin(),
+                id.end(),
+                targetName.begin(),
+                targetName.end(),
+                [] (char characterA, char characterB) {
+                    // std::lexicographical_compare() calls this with the arguments in either order
+                    return toLower(characterA) < toLower(characterB);
+                }
+            );
+        }
+
+        constexpr bool idEqualsName(std::string_view id, std::string_view targetName) {
+            return std::equal(
+                id.begin(),
+                id.end(),
+                targetName.begin(),
+                targetName.end(),
+                [] (char idCharacter, char nameCharacter) {
+                    return idCharacter == toLower(nameCharacter);
+                }
+            );
+        }
+
+        static_assert(
+            std::is_sorted(
+                GENERATED_TARGET_DESCRIPTION_FILE_MAPPING.begin(),
+                GENERATED_TARGET_DESCRIPTION_FILE_MAPPING.end(),
+                [] (const auto& entryA, const auto& entryB) {
+                    return entryA.id < entryB.id;
+                }
+            ),
+            "The generated target description file mapping must be sorted by target ID"
+        );
+    }
+
+    std::span<const TargetDescriptionFileMapping::Entry> TargetDescriptionFileMapping::entries() {
+        return GENERATED_TARGET_DESCRIPTION_FILE_MAPPING;
+    }
+
+    const TargetDescriptionFileMapping::Entry* TargetDescriptionFileMapping::find(std::string_view targetName) {
+        const auto entryIt = std::lower_bound(
+            GENERATED_TARGET_DESCRIPTION_FILE_MAPPING.begin(),
+            GENERATED_TARGET_DESCRIPTION_FILE_MAPPING.end(),
+            targetName,
+            [] (const Entry& entry, std::string_view targetName) {
+                return idLessThanName(entry.id, targetName);
+            }
+        );
+
+        if (entryIt == GENERATED_TARGET_DESCRIPTION_FILE_MAPPING.end() || !idEqualsName(entryIt->id, targetName)) {
+            return nullptr;
+        }
+
+        return &(*entryIt);
+    }
+}
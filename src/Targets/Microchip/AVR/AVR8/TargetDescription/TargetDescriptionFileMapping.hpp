@@ -0,0 +1,64 @@
+#pragma once
+
+#include <string_view>
+#include <span>
+
+#include "src/Targets/Microchip/AVR/AVR8/Family.hpp"
+
+namespace Targets::Microchip::Avr::Avr8Bit::TargetDescription
+{
+    /**
+     * The mapping of AVR8 target IDs to target description files.
+     *
+     * The mapping is generated at build time, by build/scripts/Avr8TargetDescriptionFiles.php, as a sorted constexpr
+     * array (see Avr8TargetDescriptionFileMapping.generated.hpp, in the build directory). Lookups are performed via
+     * a binary search, without any allocations.
+     */
+    class TargetDescriptionFileMapping
+    {
+    public:
+        struct Entry
+        {
+            /**
+             * The target ID - the lower-case target name, with spaces replaced by underscores. The mapping is
+             * sorted by this.
+             */
+            std::string_view id;
+
+            std::string_view name;
+
+            unsigned char signatureByteZero = 0x00;
+            unsigned char signatureByteOne = 0x00;
+            unsigned char signatureByteTwo = 0x00;
+
+            Family family = Family::MEGA;
+
+            /**
+             * Relative to Bloom's resources directory.
+             */
+            std::string_view tdfPath;
+
+            /**
+             * Relative to Bloom's resources directory. Empty if the TDF could not be compiled at build time.
+             */
+            std::string_view compiledTdfPath;
+        };
+
+        /**
+         * Returns all entries in the mapping, sorted by target ID.
+         *
+         * @return
+         */
+        static std::span<const Entry> entries();
+
+        /**
+         * Looks up a target by name. The lookup is case-insensitive.
+         *
+         * @param targetName
+         *
+         * @return
+         *  nullptr if the target is unknown.
+         */
+        static const Entry* find(std::string_view targetName);
+    };
+}
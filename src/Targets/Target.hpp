@@ -124,6 +124,20 @@ namespace Targets
          */
         virtual void removeSoftwareBreakpoint(TargetMemoryAddress address) = 0;
 
+        /**
+         * Should set software breakpoints at the given addresses, in as few operations as possible.
+         *
+         * @param addresses
+         */
+        virtual void setSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) = 0;
+
+        /**
+         * Should remove software breakpoints at the given addresses, in as few operations as possible.
+         *
+         * @param addresses
+         */
+        virtual void removeSoftwareBreakpoints(const std::vector<TargetMemoryAddress>& addresses) = 0;
+
         /**
          * Should set a hardware breakpoint on the target, at the given address.
          *
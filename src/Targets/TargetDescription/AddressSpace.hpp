@@ -14,5 +14,7 @@ namespace Targets::TargetDescription
         std::uint32_t size;
         bool littleEndian = true;
         std::map<MemorySegmentType, std::map<std::string, MemorySegment>> memorySegmentsByTypeAndName;
+
+        bool operator == (const AddressSpace& other) const = default;
     };
 }
@@ -9,5 +9,7 @@ namespace Targets::TargetDescription
     {
         std::string name;
         std::uint8_t mask;
+
+        bool operator == (const BitField& other) const = default;
     };
 }
@@ -0,0 +1,167 @@
+#include "CompiledTargetDescriptionFile.hpp"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+
+#include "src/Exceptions/Exception.hpp"
+
+namespace Targets::TargetDescription
+{
+    using Exceptions::Exception;
+
+    CompiledTargetDescriptionFile::CompiledTargetDescriptionFile(const std::string& filePath) {
+        const auto fileDescriptor = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0) {
+            throw Exception(
+                "Failed to open compiled target description file - error number: " + std::to_string(errno)
+            );
+        }
+
+        struct stat fileStatus = {};
+        if (::fstat(fileDescriptor, &fileStatus) != 0) {
+            ::close(fileDescriptor);
+            throw Exception(
+                "Failed to stat compiled target description file - error number: " + std::to_string(errno)
+            );
+        }
+
+        static constexpr auto HEADER_SIZE = static_cast<std::size_t>((8 + SECTION_COUNT * 2) * 4);
+
+        if (fileStatus.st_size < static_cast<off_t>(HEADER_SIZE)) {
+            ::close(fileDescriptor);
+            throw Exception("Invalid compiled target description file - file too small");
+        }
+
+        this->size = static_cast<std::size_t>(fileStatus.st_size);
+        auto* mapping = ::mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+        // The mapping remains valid after the file descriptor is closed
+        ::close(fileDescriptor);
+
+        if (mapping == MAP_FAILED) {
+            throw Exception(
+                "Failed to map compiled target description file - error number: " + std::to_string(errno)
+            );
+        }
+
+        this->data = static_cast<const unsigned char*>(mapping);
+
+        /*
+         * If the header turns out to be invalid, we throw from the constructor, meaning the destructor will not be
+         * called. So we have to unmap the file ourselves.
+         */
+        try {
+            if (this->wordAt(0) != CompiledTargetDescriptionFile::MAGIC) {
+                throw Exception("Invalid compiled target description file - magic number mismatch");
+            }
+
+            const auto version = this->wordAt(4);
+            if (version != CompiledTargetDescriptionFile::VERSION) {
+                throw Exception(
+                    "Unsupported compiled target description file version (" + std::to_string(version)
+                        + ", expected " + std::to_string(CompiledTargetDescriptionFile::VERSION) + ")"
+                );
+            }
+
+            if (this->wordAt(8) != this->size) {
+                throw Exception("Invalid compiled target description file - size mismatch");
+            }
+
+            if (this->wordAt(28) != SECTION_COUNT) {
+                throw Exception("Invalid compiled target description file - section count mismatch");
+            }
+
+            for (auto sectionIndex = std::size_t{0}; sectionIndex < SECTION_COUNT; ++sectionIndex) {
+                auto& section = this->sections[sectionIndex];
+                section.offset = this->wordAt(32 + sectionIndex * 8);
+                section.count = this->wordAt(36 + sectionIndex * 8);
+
+                const auto recordSize = CompiledTargetDescriptionFile::RECORD_WORDS[sectionIndex] * 4;
+                const auto sectionSize = static_cast<std::uint64_t>(section.count) * (recordSize > 0 ? recordSize : 1);
+
+                if (section.offset < HEADER_SIZE || section.offset + sectionSize > this->size) {
+                    throw Exception(
+                        "Invalid compiled target description file - section " + std::to_string(sectionIndex)
+                            + " out of bounds"
+                    );
+                }
+            }
+
+        } catch (const Exception&) {
+            ::munmap(mapping, this->size);
+            throw;
+        }
+    }
+
+    CompiledTargetDescriptionFile::~CompiledTargetDescriptionFile() {
+        ::munmap(const_cast<unsigned char*>(this->data), this->size);
+    }
+
+    std::string CompiledTargetDescriptionFile::targetName() const {
+        return this->stringAt(12).value_or(std::string());
+    }
+
+    std::string CompiledTargetDescriptionFile::familyName() const {
+        return this->stringAt(20).value_or(std::string());
+    }
+
+    std::uint32_t CompiledTargetDescriptionFile::recordCount(Section section) const {
+        return this->sections[static_cast<std::size_t>(section)].count;
+    }
+
+    CompiledTargetDescriptionFile::Record CompiledTargetDescriptionFile::record(
+        Section section,
+        std::uint32_t index
+    ) const {
+        const auto sectionIndex = static_cast<std::size_t>(section);
+        const auto& descriptor = this->sections[sectionIndex];
+
+        if (section == Section::STRINGS || index >= descriptor.count) {
+            throw Exception(
+                "Compiled target description file record index (" + std::to_string(index) + ") out of bounds, in "
+                    "section " + std::to_string(sectionIndex)
+            );
+        }
+
+        return Record(
+            *this,
+            descriptor.offset
+                + static_cast<std::size_t>(index) * CompiledTargetDescriptionFile::RECORD_WORDS[sectionIndex] * 4
+        );
+    }
+
+    std::uint32_t CompiledTargetDescriptionFile::wordAt(std::size_t offset) const {
+        if (offset + 4 > this->size) {
+            throw Exception("Compiled target description file read out of bounds");
+        }
+
+        // Always little-endian, regardless of the host
+        const auto* bytes = this->data + offset;
+        return static_cast<std::uint32_t>(bytes[0])
+            | static_cast<std::uint32_t>(bytes[1]) << 8
+            | static_cast<std::uint32_t>(bytes[2]) << 16
+            | static_cast<std::uint32_t>(bytes[3]) << 24;
+    }
+
+    std::optional<std::string> CompiledTargetDescriptionFile::stringAt(std::size_t offset) const {
+        const auto stringOffset = this->wordAt(offset);
+        if (stringOffset == CompiledTargetDescriptionFile::NULL_STRING) {
+            return std::nullopt;
+        }
+
+        const auto stringLength = this->wordAt(offset + 4);
+        const auto& strings = this->sections[static_cast<std::size_t>(Section::STRINGS)];
+
+        if (static_cast<std::uint64_t>(stringOffset) + stringLength > strings.count) {
+            throw Exception("Compiled target description file string out of bounds");
+        }
+
+        return std::string(
+            reinterpret_cast<const char*>(this->data + strings.offset + stringOffset),
+            stringLength
+        );
+    }
+}
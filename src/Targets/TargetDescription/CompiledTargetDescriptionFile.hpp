@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <optional>
+#include <array>
+
+namespace Targets::TargetDescription
+{
+    /**
+     * A read-only view of a compiled target description file, mapped into memory via mmap().
+     *
+     * Compiled TDFs are generated from the XML TDFs at build time (see
+     * build/scripts/TargetDescriptionFiles/CompiledTdfWriter.php). They hold the same data that
+     * TargetDescriptionFile extracts from the XML, so that we can load a TDF without parsing any XML.
+     *
+     * The file consists entirely of little-endian 32-bit words:
+     *
+     *  - The header:
+     *      magic ("BTDF"), format version, file size (in bytes), target name, family name, section count, followed by
+     *      the offset (in bytes) and record count of each section.
+     *  - The sections, one per Section value. Each section is a flat array of fixed-size records. Parent records
+     *    reference their children via an index and a count (e.g. an address space references a range of records in
+     *    the MEMORY_SEGMENTS section).
+     *  - The STRINGS section is a blob of UTF-8 strings. Its record count is its size in bytes. All strings are
+     *    referenced via two words: an offset into the STRINGS section and a length. An offset of
+     *    CompiledTargetDescriptionFile::NULL_STRING represents an absent (std::nullopt) string.
+     *
+     * The writer and this class must agree on the layout of each record. Any change to the layout requires a bump of
+     * CompiledTargetDescriptionFile::VERSION, in both.
+     */
+    class CompiledTargetDescriptionFile
+    {
+    public:
+        static constexpr std::uint32_t MAGIC = 0x46445442; // "BTDF"
+        static constexpr std::uint32_t VERSION = 1;
+        static constexpr std::uint32_t NULL_STRING = 0xFFFFFFFF;
+
+        enum class Section: std::uint8_t
+        {
+            STRINGS,
+            ADDRESS_SPACES,
+            MEMORY_SEGMENTS,
+            PROPERTY_GROUPS,
+            PROPERTIES,
+            MODULES,
+            PERIPHERAL_MODULES,
+            MODULE_INSTANCES,
+            REGISTER_GROUPS,
+            REGISTERS,
+            BIT_FIELDS,
+            SIGNALS,
+            VARIANTS,
+            PINOUTS,
+            PINS,
+            INTERFACES,
+        };
+
+        static constexpr auto SECTION_COUNT = std::size_t{16};
+
+        /**
+         * The size of a record in each section, in words. String references occupy two words.
+         *
+         * The STRINGS section has no records - its "records" are bytes.
+         */
+        static constexpr auto RECORD_WORDS = std::array<std::uint32_t, SECTION_COUNT>{
+            0,  // STRINGS
+            9,  // ADDRESS_SPACES: id, name, start address, size, little endian, first segment, segment count
+            8,  // MEMORY_SEGMENTS: name, type, start address, size, has page size, page size
+            4,  // PROPERTY_GROUPS: name, first property, property count
+            6,  // PROPERTIES: key, name, value
+            6,  // MODULES: name, first register group, register group count, first instance, instance count
+            6,  // PERIPHERAL_MODULES: (same as MODULES)
+            6,  // MODULE_INSTANCES: name, first register group, register group count, first signal, signal count
+            10, // REGISTER_GROUPS: name, module name, address space ID, has offset, offset, first register, count
+            10, // REGISTERS: name, caption, access, offset, size, first bit field, bit field count
+            3,  // BIT_FIELDS: name, mask
+            8,  // SIGNALS: pad name, function, group, has index, index
+            7,  // VARIANTS: name, pinout name, package, disabled
+            4,  // PINOUTS: name, first pin, pin count
+            3,  // PINS: pad, position
+            4,  // INTERFACES: name, type
+        };
+
+        class Record
+        {
+        public:
+            Record(const CompiledTargetDescriptionFile& file, std::size_t offset)
+                : file(file)
+                , offset(offset)
+            {}
+
+            [[nodiscard]] std::uint32_t word(std::uint32_t index) const {
+                return this->file.wordAt(this->offset + index * 4);
+            }
+
+            [[nodiscard]] std::string string(std::uint32_t index) const {
+                return this->optionalString(index).value_or(std::string());
+            }
+
+            [[nodiscard]] std::optional<std::string> optionalString(std::uint32_t index) const {
+                return this->file.stringAt(this->offset + index * 4);
+            }
+
+        private:
+            const CompiledTargetDescriptionFile& file;
+            std::size_t offset;
+        };
+
+        /**
+         * Maps the compiled TDF into memory and validates its header.
+         *
+         * @param filePath
+         *
+         * @throws Exceptions::Exception
+         *  If the file cannot be mapped, or is not a valid compiled TDF of the current version.
+         */
+        explicit CompiledTargetDescriptionFile(const std::string& filePath);
+        ~CompiledTargetDescriptionFile();
+
+        CompiledTargetDescriptionFile(const CompiledTargetDescriptionFile& other) = delete;
+        CompiledTargetDescriptionFile& operator = (const CompiledTargetDescriptionFile& other) = delete;
+
+        [[nodiscard]] std::string targetName() const;
+        [[nodiscard]] std::string familyName() const;
+
+        /**
+         * Returns the number of records in the given section.
+         */
+        [[nodiscard]] std::uint32_t recordCount(Section section) const;
+
+        /**
+         * Returns the record at the given index, in the given section.
+         *
+         * @throws Exceptions::Exception
+         *  If the index is out of bounds.
+         */
+        [[nodiscard]] Record record(Section section, std::uint32_t index) const;
+
+    private:
+        const unsigned char* data = nullptr;
+        std::size_t size = 0;
+
+        struct SectionDescriptor
+        {
+            std::uint32_t offset = 0;
+            std::uint32_t count = 0;
+        };
+
+        std::array<SectionDescriptor, SECTION_COUNT> sections = {};
+
+        [[nodiscard]] std::uint32_t wordAt(std::size_t offset) const;
+
+        /**
+         * Reads a string reference (offset and length) at the given byte offset.
+         */
+        [[nodiscard]] std::optional<std::string> stringAt(std::size_t offset) const;
+    };
+}
@@ -9,5 +9,7 @@ namespace Targets::TargetDescription
     {
         std::string name;
         std::optional<std::string> type;
+
+        bool operator == (const Interface& other) const = default;
     };
 }
@@ -44,5 +44,7 @@ namespace Targets::TargetDescription
             {"lockbits", MemorySegmentType::LOCKBITS},
             {"osccal", MemorySegmentType::OSCCAL},
         };
+
+        bool operator == (const MemorySegment& other) const = default;
     };
 }
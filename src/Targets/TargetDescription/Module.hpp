@@ -10,5 +10,7 @@ namespace Targets::TargetDescription
         std::string name;
         std::map<std::string, ModuleInstance> instancesMappedByName;
         std::map<std::string, RegisterGroup> registerGroupsMappedByName;
+
+        bool operator == (const Module& other) const = default;
     };
 }
@@ -14,5 +14,7 @@ namespace Targets::TargetDescription
         std::string name;
         std::map<std::string, RegisterGroup> registerGroupsMappedByName;
         std::vector<Signal> instanceSignals;
+
+        bool operator == (const ModuleInstance& other) const = default;
     };
 }
@@ -9,11 +9,15 @@ namespace Targets::TargetDescription
     {
         std::string pad;
         int position;
+
+        bool operator == (const Pin& other) const = default;
     };
 
     struct Pinout
     {
         std::string name;
         std::vector<Pin> pins;
+
+        bool operator == (const Pinout& other) const = default;
     };
 }
@@ -15,11 +15,15 @@ namespace Targets::TargetDescription
          * functions to make this easier.
          */
         QString value;
+
+        bool operator == (const Property& other) const = default;
     };
 
     struct PropertyGroup
     {
         std::string name;
         std::map<std::string, Property> propertiesMappedByName;
+
+        bool operator == (const PropertyGroup& other) const = default;
     };
 }
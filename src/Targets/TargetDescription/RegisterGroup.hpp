@@ -17,6 +17,8 @@ namespace Targets::TargetDescription
         std::uint16_t size;
         std::optional<std::string> readWriteAccess;
         std::map<std::string, BitField> bitFieldsMappedByName;
+
+        bool operator == (const Register& other) const = default;
     };
 
     struct RegisterGroup
@@ -26,5 +28,7 @@ namespace Targets::TargetDescription
         std::optional<std::uint16_t> offset;
         std::optional<std::string> addressSpaceId;
         std::map<std::string, Register> registersMappedByName;
+
+        bool operator == (const RegisterGroup& other) const = default;
     };
 }
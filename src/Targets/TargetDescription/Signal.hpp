@@ -11,5 +11,7 @@ namespace Targets::TargetDescription
         std::string function;
         std::optional<int> index;
         std::string group;
+
+        bool operator == (const Signal& other) const = default;
     };
 }
@@ -54,6 +54,254 @@ namespace Targets::TargetDescription
         this->loadInterfaces(document);
     }
 
+    void TargetDescriptionFile::init(const CompiledTargetDescriptionFile& compiledFile) {
+        using Section = CompiledTargetDescriptionFile::Section;
+
+        /*
+         * The compiled TDF holds every element in document order, exactly as the XML loaders would encounter them,
+         * with invalid elements already omitted. We insert them in the same order, so that duplicates are resolved
+         * in the same way.
+         */
+        this->targetName = compiledFile.targetName();
+        this->familyName = compiledFile.familyName();
+
+        for (auto index = std::uint32_t{0}; index < compiledFile.recordCount(Section::ADDRESS_SPACES); ++index) {
+            const auto record = compiledFile.record(Section::ADDRESS_SPACES, index);
+
+            auto addressSpace = AddressSpace();
+            addressSpace.id = record.string(0);
+            addressSpace.name = record.string(2);
+            addressSpace.startAddress = record.word(4);
+            addressSpace.size = record.word(5);
+            addressSpace.littleEndian = record.word(6) != 0;
+
+            const auto firstSegmentIndex = record.word(7);
+            for (
+                auto segmentIndex = firstSegmentIndex;
+                segmentIndex < firstSegmentIndex + record.word(8);
+                ++segmentIndex
+            ) {
+                const auto segmentRecord = compiledFile.record(Section::MEMORY_SEGMENTS, segmentIndex);
+                const auto typeName = segmentRecord.string(2);
+                const auto type = MemorySegment::typesMappedByName.valueAt(typeName);
+
+                if (!type.has_value()) {
+                    throw TargetDescriptionParsingFailureException("Unknown memory segment type: \"" + typeName + "\"");
+                }
+
+                auto segment = MemorySegment();
+                segment.name = segmentRecord.string(0);
+                segment.type = type.value();
+                segment.startAddress = segmentRecord.word(4);
+                segment.size = segmentRecord.word(5);
+
+                if (segmentRecord.word(6) != 0) {
+                    segment.pageSize = static_cast<std::uint16_t>(segmentRecord.word(7));
+                }
+
+                addressSpace.memorySegmentsByTypeAndName[segment.type].insert(std::pair(segment.name, segment));
+            }
+
+            this->addressSpacesMappedById.insert(std::pair(addressSpace.id, addressSpace));
+        }
+
+        for (auto index = std::uint32_t{0}; index < compiledFile.recordCount(Section::PROPERTY_GROUPS); ++index) {
+            const auto record = compiledFile.record(Section::PROPERTY_GROUPS, index);
+
+            auto propertyGroup = PropertyGroup();
+            propertyGroup.name = record.string(0);
+
+            const auto firstPropertyIndex = record.word(2);
+            for (
+                auto propertyIndex = firstPropertyIndex;
+                propertyIndex < firstPropertyIndex + record.word(3);
+                ++propertyIndex
+            ) {
+                const auto propertyRecord = compiledFile.record(Section::PROPERTIES, propertyIndex);
+
+                auto property = Property();
+                property.name = propertyRecord.string(2);
+                property.value = QString::fromStdString(propertyRecord.string(4));
+
+                propertyGroup.propertiesMappedByName.insert(std::pair(propertyRecord.string(0), property));
+            }
+
+            this->propertyGroupsMappedByName.insert(std::pair(propertyGroup.name, propertyGroup));
+        }
+
+        const auto loadModule = [this, &compiledFile] (
+            const CompiledTargetDescriptionFile::Record& record,
+            bool peripheral
+        ) {
+            auto module = Module();
+            module.name = record.string(0);
+
+            const auto firstRegisterGroupIndex = record.word(2);
+            for (
+                auto registerGroupIndex = firstRegisterGroupIndex;
+                registerGroupIndex < firstRegisterGroupIndex + record.word(3);
+                ++registerGroupIndex
+            ) {
+                auto registerGroup = TargetDescriptionFile::generateRegisterGroupFromCompiledFile(
+                    compiledFile,
+                    registerGroupIndex
+                );
+
+                module.registerGroupsMappedByName.insert(std::pair(registerGroup.name, registerGroup));
+
+                if (peripheral && registerGroup.moduleName.has_value()) {
+                    this->peripheralRegisterGroupsMappedByModuleRegisterGroupName[registerGroup.moduleName.value()]
+                        .emplace_back(registerGroup);
+                }
+            }
+
+            const auto firstInstanceIndex = record.word(4);
+            for (
+                auto instanceIndex = firstInstanceIndex;
+                instanceIndex < firstInstanceIndex + record.word(5);
+                ++instanceIndex
+            ) {
+                const auto instanceRecord = compiledFile.record(Section::MODULE_INSTANCES, instanceIndex);
+
+                auto instance = ModuleInstance();
+                instance.name = instanceRecord.string(0);
+
+                const auto firstInstanceRegisterGroupIndex = instanceRecord.word(2);
+                for (
+                    auto registerGroupIndex = firstInstanceRegisterGroupIndex;
+                    registerGroupIndex < firstInstanceRegisterGroupIndex + instanceRecord.word(3);
+                    ++registerGroupIndex
+                ) {
+                    auto registerGroup = TargetDescriptionFile::generateRegisterGroupFromCompiledFile(
+                        compiledFile,
+                        registerGroupIndex
+                    );
+
+                    instance.registerGroupsMappedByName.insert(std::pair(registerGroup.name, registerGroup));
+                }
+
+                const auto firstSignalIndex = instanceRecord.word(4);
+                for (
+                    auto signalIndex = firstSignalIndex;
+                    signalIndex < firstSignalIndex + instanceRecord.word(5);
+                    ++signalIndex
+                ) {
+                    const auto signalRecord = compiledFile.record(Section::SIGNALS, signalIndex);
+
+                    auto signal = Signal();
+                    signal.padName = signalRecord.string(0);
+                    signal.function = signalRecord.string(2);
+                    signal.group = signalRecord.string(4);
+
+                    if (signalRecord.word(6) != 0) {
+                        signal.index = static_cast<int>(signalRecord.word(7));
+                    }
+
+                    instance.instanceSignals.emplace_back(signal);
+                }
+
+                module.instancesMappedByName.insert(std::pair(instance.name, instance));
+            }
+
+            return module;
+        };
+
+        for (auto index = std::uint32_t{0}; index < compiledFile.recordCount(Section::MODULES); ++index) {
+            auto module = loadModule(compiledFile.record(Section::MODULES, index), false);
+            this->modulesMappedByName.insert(std::pair(module.name, module));
+        }
+
+        for (auto index = std::uint32_t{0}; index < compiledFile.recordCount(Section::PERIPHERAL_MODULES); ++index) {
+            auto module = loadModule(compiledFile.record(Section::PERIPHERAL_MODULES, index), true);
+            this->peripheralModulesMappedByName.insert(std::pair(module.name, module));
+        }
+
+        for (auto index = std::uint32_t{0}; index < compiledFile.recordCount(Section::VARIANTS); ++index) {
+            const auto record = compiledFile.record(Section::VARIANTS, index);
+
+            auto variant = Variant();
+            variant.name = record.string(0);
+            variant.pinoutName = record.string(2);
+            variant.package = record.string(4);
+            variant.disabled = record.word(6) != 0;
+
+            this->variants.push_back(variant);
+        }
+
+        for (auto index = std::uint32_t{0}; index < compiledFile.recordCount(Section::PINOUTS); ++index) {
+            const auto record = compiledFile.record(Section::PINOUTS, index);
+
+            auto pinout = Pinout();
+            pinout.name = record.string(0);
+
+            const auto firstPinIndex = record.word(2);
+            for (auto pinIndex = firstPinIndex; pinIndex < firstPinIndex + record.word(3); ++pinIndex) {
+                const auto pinRecord = compiledFile.record(Section::PINS, pinIndex);
+
+                auto pin = Pin();
+                pin.pad = pinRecord.string(0);
+                pin.position = static_cast<int>(pinRecord.word(2));
+
+                pinout.pins.push_back(pin);
+            }
+
+            this->pinoutsMappedByName.insert(std::pair(pinout.name, pinout));
+        }
+
+        for (auto index = std::uint32_t{0}; index < compiledFile.recordCount(Section::INTERFACES); ++index) {
+            const auto record = compiledFile.record(Section::INTERFACES, index);
+
+            auto interface = Interface();
+            interface.name = record.string(0);
+            interface.type = record.optionalString(2);
+
+            this->interfacesByName.insert(std::pair(interface.name, interface));
+        }
+    }
+
+    void TargetDescriptionFile::verifyAgainstXml(const QString& xmlFilePath) const {
+        const auto xmlTdf = TargetDescriptionFile(xmlFilePath);
+        auto differingMembers = std::vector<std::string>();
+
+        const auto compare = [&differingMembers] (const auto& member, const auto& xmlMember, const char* name) {
+            if (member != xmlMember) {
+                differingMembers.emplace_back(name);
+            }
+        };
+
+        compare(this->targetName, xmlTdf.targetName, "targetName");
+        compare(this->familyName, xmlTdf.familyName, "familyName");
+        compare(this->addressSpacesMappedById, xmlTdf.addressSpacesMappedById, "addressSpacesMappedById");
+        compare(this->propertyGroupsMappedByName, xmlTdf.propertyGroupsMappedByName, "propertyGroupsMappedByName");
+        compare(this->modulesMappedByName, xmlTdf.modulesMappedByName, "modulesMappedByName");
+        compare(
+            this->peripheralModulesMappedByName,
+            xmlTdf.peripheralModulesMappedByName,
+            "peripheralModulesMappedByName"
+        );
+        compare(
+            this->peripheralRegisterGroupsMappedByModuleRegisterGroupName,
+            xmlTdf.peripheralRegisterGroupsMappedByModuleRegisterGroupName,
+            "peripheralRegisterGroupsMappedByModuleRegisterGroupName"
+        );
+        compare(this->variants, xmlTdf.variants, "variants");
+        compare(this->pinoutsMappedByName, xmlTdf.pinoutsMappedByName, "pinoutsMappedByName");
+        compare(this->interfacesByName, xmlTdf.interfacesByName, "interfacesByName");
+
+        if (!differingMembers.empty()) {
+            auto memberList = std::string();
+
+            for (const auto& memberName : differingMembers) {
+                memberList += (memberList.empty() ? "" : ", ") + memberName;
+            }
+
+            throw Exception(
+                "Compiled target description file does not match \"" + xmlFilePath.toStdString()
+                    + "\" - differing members: " + memberList
+            );
+        }
+    }
+
     AddressSpace TargetDescriptionFile::generateAddressSpaceFromXml(const QDomElement& xmlElement) {
         if (
             !xmlElement.hasAttribute("id")
@@ -205,6 +453,59 @@ namespace Targets::TargetDescription
         return registerGroup;
     }
 
+    RegisterGroup TargetDescriptionFile::generateRegisterGroupFromCompiledFile(
+        const CompiledTargetDescriptionFile& compiledFile,
+        std::uint32_t index
+    ) {
+        using Section = CompiledTargetDescriptionFile::Section;
+
+        const auto record = compiledFile.record(Section::REGISTER_GROUPS, index);
+
+        auto registerGroup = RegisterGroup();
+        registerGroup.name = record.string(0);
+        registerGroup.moduleName = record.optionalString(2);
+        registerGroup.addressSpaceId = record.optionalString(4);
+
+        if (record.word(6) != 0) {
+            registerGroup.offset = static_cast<std::uint16_t>(record.word(7));
+        }
+
+        const auto firstRegisterIndex = record.word(8);
+        for (
+            auto registerIndex = firstRegisterIndex;
+            registerIndex < firstRegisterIndex + record.word(9);
+            ++registerIndex
+        ) {
+            const auto registerRecord = compiledFile.record(Section::REGISTERS, registerIndex);
+
+            auto reg = Register();
+            reg.name = registerRecord.string(0);
+            reg.caption = registerRecord.optionalString(2);
+            reg.readWriteAccess = registerRecord.optionalString(4);
+            reg.offset = static_cast<std::uint16_t>(registerRecord.word(6));
+            reg.size = static_cast<std::uint16_t>(registerRecord.word(7));
+
+            const auto firstBitFieldIndex = registerRecord.word(8);
+            for (
+                auto bitFieldIndex = firstBitFieldIndex;
+                bitFieldIndex < firstBitFieldIndex + registerRecord.word(9);
+                ++bitFieldIndex
+            ) {
+                const auto bitFieldRecord = compiledFile.record(Section::BIT_FIELDS, bitFieldIndex);
+
+                auto bitField = BitField();
+                bitField.name = bitFieldRecord.string(0);
+                bitField.mask = static_cast<std::uint8_t>(bitFieldRecord.word(2));
+
+                reg.bitFieldsMappedByName.insert(std::pair(bitField.name, bitField));
+            }
+
+            registerGroup.registersMappedByName.insert(std::pair(reg.name, reg));
+        }
+
+        return registerGroup;
+    }
+
     Register TargetDescriptionFile::generateRegisterFromXml(const QDomElement& xmlElement) {
         if (
             !xmlElement.hasAttribute("name")
@@ -11,6 +11,7 @@
 #include "Variant.hpp"
 #include "Pinout.hpp"
 #include "Interface.hpp"
+#include "CompiledTargetDescriptionFile.hpp"
 
 namespace Targets::TargetDescription
 {
@@ -139,6 +140,41 @@ namespace Targets::TargetDescription
         virtual void init(const QDomDocument& document);
         void init(const QString& xmlFilePath);
 
+        /**
+         * Loads the TDF from a compiled TDF, instead of the XML. This yields the same result as loading the TDF from
+         * the XML it was compiled from, without the cost of parsing the XML.
+         *
+         * See the CompiledTargetDescriptionFile class for more.
+         *
+         * @param compiledFile
+         */
+        virtual void init(const CompiledTargetDescriptionFile& compiledFile);
+
+        /**
+         * Loads the TDF from the given XML file and checks that the result is identical to this TDF.
+         *
+         * Compiled TDFs are generated by a build script that has to mirror the XML loading in this class. This is
+         * used, in debug builds, to verify that a TDF loaded from a compiled TDF is identical to the TDF loaded from
+         * the XML it was compiled from.
+         *
+         * Will throw an exception if the two differ.
+         *
+         * @param xmlFilePath
+         */
+        void verifyAgainstXml(const QString& xmlFilePath) const;
+
+        /**
+         * Constructs a RegisterGroup object from a compiled TDF record, in the REGISTER_GROUPS section.
+         *
+         * @param compiledFile
+         * @param index
+         * @return
+         */
+        static RegisterGroup generateRegisterGroupFromCompiledFile(
+            const CompiledTargetDescriptionFile& compiledFile,
+            std::uint32_t index
+        );
+
         /**
          * Constructs an AddressSpace object from an XML element.
          *
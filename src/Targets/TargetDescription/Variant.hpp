@@ -10,5 +10,7 @@ namespace Targets::TargetDescription
         std::string pinoutName;
         std::string package;
         bool disabled = false;
+
+        bool operator == (const Variant& other) const = default;
     };
 }
@@ -97,16 +97,26 @@ namespace Targets
         TargetMemoryAccess access;
         std::optional<TargetMemorySize> pageSize;
 
+        /**
+         * Whether the memory must be erased before it can be written to.
+         *
+         * If this is false, writes will take care of erasing the affected pages, meaning individual pages can be
+         * rewritten without erasing the whole memory.
+         */
+        bool writeRequiresErase = false;
+
         TargetMemoryDescriptor(
             TargetMemoryType type,
             TargetMemoryAddressRange addressRange,
             TargetMemoryAccess access,
-            std::optional<TargetMemorySize> pageSize = std::nullopt
+            std::optional<TargetMemorySize> pageSize = std::nullopt,
+            bool writeRequiresErase = false
         )
             : type(type)
             , addressRange(addressRange)
             , access(access)
             , pageSize(pageSize)
+            , writeRequiresErase(writeRequiresErase)
         {};
 
         bool operator == (const TargetMemoryDescriptor& rhs) const {
@@ -1,6 +1,7 @@
 #include "TargetMemoryCache.hpp"
 
 #include <algorithm>
+#include <bit>
 
 #include "src/Exceptions/Exception.hpp"
 
@@ -9,117 +10,162 @@ namespace Targets
     TargetMemoryCache::TargetMemoryCache(const TargetMemoryDescriptor& memoryDescriptor)
         : memoryDescriptor(memoryDescriptor)
         , data(TargetMemoryBuffer(memoryDescriptor.size(), 0x00))
+        , populatedBitmap(
+            std::vector<BitmapWord>(
+                (memoryDescriptor.size() + TargetMemoryCache::BITMAP_WORD_BITS - 1)
+                    / TargetMemoryCache::BITMAP_WORD_BITS,
+                0
+            )
+        )
     {}
 
-    TargetMemoryBuffer TargetMemoryCache::fetch(TargetMemoryAddress startAddress, TargetMemorySize bytes) const {
-        const auto startIndex = startAddress - this->memoryDescriptor.addressRange.startAddress;
+    std::span<const unsigned char> TargetMemoryCache::fetch(
+        TargetMemoryAddress startAddress,
+        TargetMemorySize bytes
+    ) const {
+        return std::span(this->data).subspan(this->indexOf(startAddress, bytes), bytes);
+    }
 
+    bool TargetMemoryCache::contains(TargetMemoryAddress startAddress, TargetMemorySize bytes) const {
         if (
-            startAddress < this->memoryDescriptor.addressRange.startAddress
-            || (startIndex + bytes) > this->data.size()
+            bytes == 0
+            || startAddress < this->memoryDescriptor.addressRange.startAddress
+            || (static_cast<std::size_t>(startAddress - this->memoryDescriptor.addressRange.startAddress) + bytes)
+                > this->data.size()
         ) {
-            throw Exceptions::Exception("Invalid cache access");
+            return false;
         }
 
-        return TargetMemoryBuffer(this->data.begin() + startIndex, this->data.begin() + startIndex + bytes);
-    }
+        const auto startIndex = static_cast<std::size_t>(startAddress - this->memoryDescriptor.addressRange.startAddress);
+        const auto endIndex = startIndex + bytes;
 
-    bool TargetMemoryCache::contains(TargetMemoryAddress startAddress, TargetMemorySize bytes) const {
-        const auto intersectingSegmentIt = this->intersectingSegment(startAddress);
+        auto index = startIndex;
+        while (index < endIndex) {
+            const auto wordIndex = index / TargetMemoryCache::BITMAP_WORD_BITS;
+            const auto bitOffset = index % TargetMemoryCache::BITMAP_WORD_BITS;
+            const auto bitCount = std::min(TargetMemoryCache::BITMAP_WORD_BITS - bitOffset, endIndex - index);
 
-        return
-            intersectingSegmentIt != this->populatedSegments.end()
-            && intersectingSegmentIt->first <= startAddress
-            && intersectingSegmentIt->second >= (startAddress + bytes - 1);
-    }
+            const auto mask = bitCount == TargetMemoryCache::BITMAP_WORD_BITS
+                ? ~BitmapWord{0}
+                : ((BitmapWord{1} << bitCount) - 1) << bitOffset;
 
-    void TargetMemoryCache::insert(TargetMemoryAddress startAddress, const TargetMemoryBuffer& data) {
-        const auto startIndex = startAddress - this->memoryDescriptor.addressRange.startAddress;
-
-        std::copy(data.begin(), data.end(), this->data.begin() + startIndex);
+            if ((this->populatedBitmap[wordIndex] & mask) != mask) {
+                return false;
+            }
 
-        const auto endAddress = static_cast<Targets::TargetMemoryAddress>(startAddress + data.size() - 1);
+            index += bitCount;
+        }
 
-        const auto intersectingStartSegmentIt = this->intersectingSegment(startAddress);
-        const auto intersectingEndSegmentIt = this->intersectingSegment(endAddress);
+        return true;
+    }
 
-        if (
-            intersectingStartSegmentIt == this->populatedSegments.end()
-            && intersectingEndSegmentIt == this->populatedSegments.end()
-        ) {
-            this->populatedSegments.insert(std::pair(startAddress, endAddress));
+    void TargetMemoryCache::insert(TargetMemoryAddress startAddress, std::span<const unsigned char> data) {
+        if (data.empty()) {
             return;
         }
 
-        if (intersectingStartSegmentIt == intersectingEndSegmentIt) {
-            // We already have a populated segment containing this address range. Nothing to do here.
-            return;
-        }
+        const auto startIndex = this->indexOf(startAddress, static_cast<TargetMemorySize>(data.size()));
 
-        auto newStartSegment = std::optional<decltype(this->populatedSegments)::value_type>();
-        auto newEndSegment = std::optional<decltype(this->populatedSegments)::value_type>();
+        std::copy(data.begin(), data.end(), this->data.begin() + static_cast<std::ptrdiff_t>(startIndex));
+        this->markRange(startIndex, startIndex + data.size(), true);
+    }
 
-        if (intersectingStartSegmentIt != this->populatedSegments.end()) {
-            newStartSegment.emplace(intersectingStartSegmentIt->first, endAddress);
-            this->populatedSegments.erase(intersectingStartSegmentIt);
+    void TargetMemoryCache::invalidate(TargetMemoryAddress startAddress, TargetMemorySize bytes) {
+        if (bytes == 0) {
+            return;
         }
 
-        if (intersectingEndSegmentIt != this->populatedSegments.end()) {
-            newEndSegment.emplace(startAddress, intersectingEndSegmentIt->second);
-            this->populatedSegments.erase(intersectingEndSegmentIt);
-        }
+        const auto startIndex = this->indexOf(startAddress, bytes);
+        this->markRange(startIndex, startIndex + bytes, false);
+    }
 
-        if (newStartSegment.has_value() && newEndSegment.has_value()) {
-            // The two new segments overlap. Merge them into one and remove any segments between them
-            newStartSegment.emplace(newStartSegment->first, newEndSegment->second);
-            newEndSegment.reset();
+    void TargetMemoryCache::clear() {
+        std::fill(this->populatedBitmap.begin(), this->populatedBitmap.end(), 0);
+    }
 
-            for (
-                auto segmentIt = this->populatedSegments.upper_bound(newStartSegment->first);
-                segmentIt != this->populatedSegments.end();
-            ) {
-                if (segmentIt->second > newStartSegment->second) {
+    std::vector<TargetMemoryAddressRange> TargetMemoryCache::populatedRanges() const {
+        auto output = std::vector<TargetMemoryAddressRange>();
+        const auto memoryStartAddress = this->memoryDescriptor.addressRange.startAddress;
+        const auto size = this->data.size();
+
+        auto index = std::size_t{0};
+        while (index < size) {
+            const auto wordIndex = index / TargetMemoryCache::BITMAP_WORD_BITS;
+            const auto bitOffset = index % TargetMemoryCache::BITMAP_WORD_BITS;
+            const auto word = this->populatedBitmap[wordIndex] >> bitOffset;
+
+            if (word == 0) {
+                // Skip the rest of this word
+                index += TargetMemoryCache::BITMAP_WORD_BITS - bitOffset;
+                continue;
+            }
+
+            // Skip to the first populated byte in this word, then find the end of the populated run
+            index += static_cast<std::size_t>(std::countr_zero(word));
+            const auto runStartIndex = index;
+
+            while (index < size) {
+                const auto runWord = ~(
+                    this->populatedBitmap[index / TargetMemoryCache::BITMAP_WORD_BITS]
+                        >> (index % TargetMemoryCache::BITMAP_WORD_BITS)
+                );
+
+                const auto remainingBits = TargetMemoryCache::BITMAP_WORD_BITS
+                    - (index % TargetMemoryCache::BITMAP_WORD_BITS);
+                const auto populatedBits = std::min(
+                    static_cast<std::size_t>(std::countr_zero(runWord)),
+                    remainingBits
+                );
+
+                index += populatedBits;
+                if (populatedBits < remainingBits) {
                     break;
                 }
-
-                this->populatedSegments.erase(segmentIt++);
             }
-        }
 
-        if (newStartSegment.has_value()) {
-            this->populatedSegments.insert(*newStartSegment);
+            index = std::min(index, size);
+            output.emplace_back(
+                static_cast<TargetMemoryAddress>(memoryStartAddress + runStartIndex),
+                static_cast<TargetMemoryAddress>(memoryStartAddress + index - 1)
+            );
         }
 
-        if (newEndSegment.has_value()) {
-            this->populatedSegments.insert(*newEndSegment);
-        }
+        return output;
     }
 
-    void TargetMemoryCache::clear() {
-        this->populatedSegments.clear();
-    }
+    void TargetMemoryCache::markRange(std::size_t startIndex, std::size_t endIndex, bool populated) {
+        auto index = startIndex;
 
-    TargetMemoryCache::SegmentIt TargetMemoryCache::intersectingSegment(TargetMemoryAddress address) const {
-        if (this->populatedSegments.empty()) {
-            return this->populatedSegments.end();
-        }
+        while (index < endIndex) {
+            const auto wordIndex = index / TargetMemoryCache::BITMAP_WORD_BITS;
+            const auto bitOffset = index % TargetMemoryCache::BITMAP_WORD_BITS;
+            const auto bitCount = std::min(TargetMemoryCache::BITMAP_WORD_BITS - bitOffset, endIndex - index);
 
-        auto lowerBoundSegmentIt = this->populatedSegments.lower_bound(address);
+            const auto mask = bitCount == TargetMemoryCache::BITMAP_WORD_BITS
+                ? ~BitmapWord{0}
+                : ((BitmapWord{1} << bitCount) - 1) << bitOffset;
 
-        if (lowerBoundSegmentIt != this->populatedSegments.end()) {
-            if (lowerBoundSegmentIt->first != address && lowerBoundSegmentIt != this->populatedSegments.begin()) {
-                --lowerBoundSegmentIt;
+            if (populated) {
+                this->populatedBitmap[wordIndex] |= mask;
+
+            } else {
+                this->populatedBitmap[wordIndex] &= ~mask;
             }
 
-            return lowerBoundSegmentIt->first <= address && lowerBoundSegmentIt->second >= address
-                ? lowerBoundSegmentIt
-                : this->populatedSegments.end();
+            index += bitCount;
+        }
+    }
+
+    std::size_t TargetMemoryCache::indexOf(TargetMemoryAddress startAddress, TargetMemorySize bytes) const {
+        const auto startIndex = static_cast<std::size_t>(startAddress - this->memoryDescriptor.addressRange.startAddress);
+
+        if (
+            startAddress < this->memoryDescriptor.addressRange.startAddress
+            || (startIndex + bytes) > this->data.size()
+        ) {
+            throw Exceptions::Exception("Invalid cache access");
         }
 
-        // All the segments precede the given address. If the last segment doesn't intersect, none of them will.
-        const auto lastSegment = std::prev(this->populatedSegments.end());
-        return lastSegment->first <= address && lastSegment->second >= address
-            ? lastSegment
-            : this->populatedSegments.end();
+        return startIndex;
     }
 }
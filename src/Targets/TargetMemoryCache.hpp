@@ -1,7 +1,8 @@
 #pragma once
 
 #include <cstdint>
-#include <map>
+#include <vector>
+#include <span>
 
 #include "TargetMemory.hpp"
 
@@ -15,12 +16,15 @@ namespace Targets
         /**
          * Fetches data from the cache.
          *
+         * The returned span is a view of the cache's internal buffer. It will remain valid until the cache is
+         * destroyed, but the data it refers to may change upon the next call to TargetMemoryCache::insert().
+         *
          * @param startAddress
          * @param bytes
          *
          * @return
          */
-        TargetMemoryBuffer fetch(TargetMemoryAddress startAddress, TargetMemorySize bytes) const;
+        std::span<const unsigned char> fetch(TargetMemoryAddress startAddress, TargetMemorySize bytes) const;
 
         /**
          * Checks if the cache currently holds data within the given address range.
@@ -33,40 +37,70 @@ namespace Targets
         bool contains(TargetMemoryAddress startAddress, TargetMemorySize bytes) const;
 
         /**
-         * Inserts data into the cache and performs any necessary bookkeeping.
+         * Inserts data into the cache and marks the address range as populated.
          *
          * @param startAddress
          * @param data
          */
-        void insert(TargetMemoryAddress startAddress, const TargetMemoryBuffer& data);
+        void insert(TargetMemoryAddress startAddress, std::span<const unsigned char> data);
+
+        /**
+         * Removes the given address range from the cache.
+         *
+         * @param startAddress
+         * @param bytes
+         */
+        void invalidate(TargetMemoryAddress startAddress, TargetMemorySize bytes);
 
         /**
          * Clears the cache.
          */
         void clear();
 
+        /**
+         * Returns the address ranges of all populated segments in the cache, in ascending order.
+         *
+         * @return
+         */
+        std::vector<TargetMemoryAddressRange> populatedRanges() const;
+
     private:
+        using BitmapWord = std::uint64_t;
+        static constexpr std::size_t BITMAP_WORD_BITS = sizeof(BitmapWord) * 8;
+
         const TargetMemoryDescriptor& memoryDescriptor;
         TargetMemoryBuffer data;
 
         /**
-         * A populated segment is just an address range in the cache that we know we've populated.
+         * One bit per byte of memory, set if we've populated that byte.
+         *
+         * A bitmap (as opposed to a set of address ranges) keeps the cost of insertions constant, regardless of how
+         * fragmented the populated ranges are. GDB tends to issue lots of small, scattered reads (when unwinding the
+         * stack, for example).
+         *
+         * Range queries test 64 bytes at a time, so checking a whole page takes a handful of word comparisons.
+         */
+        std::vector<BitmapWord> populatedBitmap;
+
+        /**
+         * Sets or clears the populated bits for the given range of byte indices.
+         *
+         * @param startIndex
+         * @param endIndex
+         *  Exclusive.
          *
-         * populatedSegments::value_type::first = The start address (inclusive) of the populated range
-         * populatedSegments::value_type::second = The end address (inclusive) of the populated range
+         * @param populated
          */
-        std::map<TargetMemoryAddress, TargetMemoryAddress> populatedSegments = {};
+        void markRange(std::size_t startIndex, std::size_t endIndex, bool populated);
 
         /**
-         * Finds the segment that intersects with the given address. Segments cannot overlap, so only one segment can
-         * intersect with the given address, at any given time.
+         * Returns the data buffer index of the given address, after validating the address range.
          *
-         * @param address
+         * @param startAddress
+         * @param bytes
          *
          * @return
-         *  An iterator to the intersecting segment, or populatedSegments::end() if none is found.
          */
-        using SegmentIt = decltype(TargetMemoryCache::populatedSegments)::const_iterator;
-        SegmentIt intersectingSegment(TargetMemoryAddress address) const;
+        std::size_t indexOf(TargetMemoryAddress startAddress, TargetMemorySize bytes) const;
     };
 }
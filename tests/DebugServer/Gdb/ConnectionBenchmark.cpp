@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <thread>
+
+#include "src/DebugServer/Gdb/Connection.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+#include "LoopbackClient.hpp"
+
+namespace
+{
+    using DebugServer::Gdb::Connection;
+    using DebugServer::Gdb::ResponsePackets::ResponsePacket;
+
+    /**
+     * Measures the time taken for a packet round trip over a loopback connection, as seen by the client, with
+     * acknowledgements enabled (state.range(0) == 1) and disabled (QStartNoAckMode).
+     *
+     * The server responds to every packet with 4 bytes of hex-encoded memory, as it would for a GDB "m" packet.
+     * Target access time is not included.
+     */
+    void packetRoundTrip(benchmark::State& state) {
+        const auto acknowledgementsEnabled = state.range(0) == 1;
+
+        auto client = LoopbackClient();
+        auto interruptEventNotifier = EventFdNotifier();
+        auto connection = Connection(client.serverSocketFileDescriptor, interruptEventNotifier);
+
+        if (!acknowledgementsEnabled) {
+            connection.disableAcknowledgements();
+        }
+
+        auto serverThread = std::thread([&connection] {
+            const auto response = ResponsePacket(std::string("aabbccdd"));
+
+            try {
+                while (true) {
+                    connection.readRawPacket();
+                    connection.writePacket(response);
+                }
+
+            } catch (const Exceptions::Exception&) {
+                // The client has disconnected
+            }
+        });
+
+        for (auto _ : state) {
+            client.sendPacket("m100,4");
+            benchmark::DoNotOptimize(client.readUntilPacketEnd());
+
+            if (acknowledgementsEnabled) {
+                client.write("+");
+            }
+        }
+
+        client.disconnect();
+        serverThread.join();
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    }
+
+    BENCHMARK(packetRoundTrip)->ArgName("acknowledgements")->Arg(1)->Arg(0)->UseRealTime();
+}
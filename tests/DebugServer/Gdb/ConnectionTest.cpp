@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <chrono>
+
+#include "src/DebugServer/Gdb/Connection.hpp"
+#include "src/DebugServer/Gdb/ResponsePackets/ResponsePacket.hpp"
+
+#include "LoopbackClient.hpp"
+
+namespace DebugServer::Gdb
+{
+    using ResponsePackets::ResponsePacket;
+
+    class ConnectionTest: public ::testing::Test
+    {
+    protected:
+        LoopbackClient client;
+        EventFdNotifier interruptEventNotifier;
+        Connection connection = Connection(this->client.serverSocketFileDescriptor, this->interruptEventNotifier);
+
+        std::string readRawPacket() {
+            const auto rawPacket = this->connection.readRawPacket();
+            return std::string(rawPacket.begin(), rawPacket.end());
+        }
+
+        /**
+         * Confirms that the server has sent nothing further.
+         */
+        void expectNothingPending() {
+            EXPECT_FALSE(this->client.readByte(std::chrono::milliseconds(50)).has_value());
+        }
+    };
+
+    TEST_F(ConnectionTest, RoundTripWithAcknowledgements) {
+        this->client.sendPacket("m100,4");
+        EXPECT_EQ(this->readRawPacket(), LoopbackClient::rawPacket("m100,4"));
+
+        // The server waits for the client to acknowledge the response
+        auto writeThread = std::thread([this] {
+            this->connection.writePacket(ResponsePacket(std::string("aabbccdd")));
+        });
+
+        EXPECT_EQ(this->client.readUntilPacketEnd(), "+" + LoopbackClient::rawPacket("aabbccdd"));
+        this->client.write("+");
+
+        writeThread.join();
+        this->expectNothingPending();
+    }
+
+    TEST_F(ConnectionTest, NegativeAcknowledgementTriggersRetransmission) {
+        auto writeThread = std::thread([this] {
+            this->connection.writePacket(ResponsePacket(std::string("OK")));
+        });
+
+        EXPECT_EQ(this->client.readUntilPacketEnd(), LoopbackClient::rawPacket("OK"));
+        this->client.write("-");
+
+        EXPECT_EQ(this->client.readUntilPacketEnd(), LoopbackClient::rawPacket("OK"));
+        this->client.write("+");
+
+        writeThread.join();
+        this->expectNothingPending();
+    }
+
+    TEST_F(ConnectionTest, AcknowledgementWithNextPacketAttached) {
+        auto writeThread = std::thread([this] {
+            this->connection.writePacket(ResponsePacket(std::string("OK")));
+        });
+
+        EXPECT_EQ(this->client.readUntilPacketEnd(), LoopbackClient::rawPacket("OK"));
+        this->client.write("+" + LoopbackClient::rawPacket("g"));
+
+        writeThread.join();
+
+        // The packet that arrived with the acknowledgement must not be lost
+        EXPECT_EQ(this->readRawPacket(), LoopbackClient::rawPacket("g"));
+    }
+
+    TEST_F(ConnectionTest, RoundTripWithoutAcknowledgements) {
+        // As the GDB client would: the QStartNoAckMode response is still acknowledged
+        this->client.sendPacket("QStartNoAckMode");
+        EXPECT_EQ(this->readRawPacket(), LoopbackClient::rawPacket("QStartNoAckMode"));
+
+        auto writeThread = std::thread([this] {
+            this->connection.writePacket(ResponsePacket(std::string("OK")));
+            this->connection.disableAcknowledgements();
+        });
+
+        EXPECT_EQ(this->client.readUntilPacketEnd(), "+" + LoopbackClient::rawPacket("OK"));
+        this->client.write("+");
+        writeThread.join();
+
+        for (auto i = 0; i < 3; ++i) {
+            this->client.sendPacket("m100,4");
+            EXPECT_EQ(this->readRawPacket(), LoopbackClient::rawPacket("m100,4"));
+
+            // No acknowledgement is expected, so this must not block
+            this->connection.writePacket(ResponsePacket(std::string("aabbccdd")));
+
+            EXPECT_EQ(this->client.readUntilPacketEnd(), LoopbackClient::rawPacket("aabbccdd"));
+        }
+
+        this->expectNothingPending();
+    }
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <poll.h>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <chrono>
+#include <optional>
+
+#include "src/Exceptions/Exception.hpp"
+
+/**
+ * Plays the part of the GDB client, over a loopback TCP connection.
+ *
+ * Upon construction, the client connects to a listening socket on the loopback interface. The server end of the
+ * connection can then be accepted by constructing a DebugServer::Gdb::Connection with
+ * LoopbackClient::serverSocketFileDescriptor.
+ */
+class LoopbackClient
+{
+public:
+    int serverSocketFileDescriptor = -1;
+
+    LoopbackClient() {
+        this->serverSocketFileDescriptor = ::socket(AF_INET, SOCK_STREAM, 0);
+
+        auto socketAddress = sockaddr_in();
+        socketAddress.sin_family = AF_INET;
+        socketAddress.sin_addr.s_addr = ::htonl(INADDR_LOOPBACK);
+        socketAddress.sin_port = 0;
+
+        auto socketAddressLength = static_cast<socklen_t>(sizeof(socketAddress));
+
+        if (
+            ::bind(
+                this->serverSocketFileDescriptor,
+                reinterpret_cast<const sockaddr*>(&socketAddress),
+                socketAddressLength
+            ) < 0
+            || ::listen(this->serverSocketFileDescriptor, 1) < 0
+            || ::getsockname(
+                this->serverSocketFileDescriptor,
+                reinterpret_cast<sockaddr*>(&socketAddress),
+                &socketAddressLength
+            ) < 0
+        ) {
+            throw Exceptions::Exception("Failed to create loopback server socket");
+        }
+
+        this->socketFileDescriptor = ::socket(AF_INET, SOCK_STREAM, 0);
+
+        if (
+            ::connect(
+                this->socketFileDescriptor,
+                reinterpret_cast<const sockaddr*>(&socketAddress),
+                socketAddressLength
+            ) < 0
+        ) {
+            throw Exceptions::Exception("Failed to connect to loopback server socket");
+        }
+
+        // GDB disables Nagle's algorithm on its end of the connection
+        const auto enableNoDelay = 1;
+        ::setsockopt(this->socketFileDescriptor, IPPROTO_TCP, TCP_NODELAY, &enableNoDelay, sizeof(enableNoDelay));
+    }
+
+    ~LoopbackClient() {
+        this->disconnect();
+
+        if (this->serverSocketFileDescriptor >= 0) {
+            ::close(this->serverSocketFileDescriptor);
+        }
+    }
+
+    LoopbackClient(const LoopbackClient& other) = delete;
+    LoopbackClient& operator = (const LoopbackClient& other) = delete;
+
+    /**
+     * Frames the given packet data, as the GDB client would.
+     */
+    static std::string rawPacket(std::string_view data) {
+        auto checksum = static_cast<unsigned char>(0);
+        for (const auto character : data) {
+            checksum = static_cast<unsigned char>(checksum + static_cast<unsigned char>(character));
+        }
+
+        char checksumHex[3];
+        std::snprintf(checksumHex, sizeof(checksumHex), "%02x", checksum);
+
+        return "$" + std::string(data) + "#" + checksumHex;
+    }
+
+    void write(std::string_view data) {
+        if (::write(this->socketFileDescriptor, data.data(), data.size()) != static_cast<ssize_t>(data.size())) {
+            throw Exceptions::Exception("Failed to write to loopback socket");
+        }
+    }
+
+    void sendPacket(std::string_view data) {
+        this->write(LoopbackClient::rawPacket(data));
+    }
+
+    /**
+     * Reads a single byte from the server.
+     *
+     * @return
+     *  The byte, or std::nullopt if nothing was received within the timeout.
+     */
+    std::optional<char> readByte(std::chrono::milliseconds timeout = std::chrono::milliseconds(1000)) {
+        if (this->bufferPosition == this->buffer.size()) {
+            auto pollDescriptor = ::pollfd{.fd = this->socketFileDescriptor, .events = POLLIN, .revents = 0};
+
+            if (::poll(&pollDescriptor, 1, static_cast<int>(timeout.count())) <= 0) {
+                return std::nullopt;
+            }
+
+            this->buffer.resize(4096);
+            const auto bytesRead = ::read(this->socketFileDescriptor, this->buffer.data(), this->buffer.size());
+
+            if (bytesRead <= 0) {
+                throw Exceptions::Exception("Failed to read from loopback socket");
+            }
+
+            this->buffer.resize(static_cast<std::size_t>(bytesRead));
+            this->bufferPosition = 0;
+        }
+
+        return this->buffer[this->bufferPosition++];
+    }
+
+    /**
+     * Reads everything up to, and including, the checksum of the next packet from the server. This includes any
+     * acknowledgements preceding the packet.
+     */
+    std::string readUntilPacketEnd() {
+        auto output = std::string();
+        auto checksumBytesRemaining = std::optional<int>();
+
+        while (!checksumBytesRemaining.has_value() || *checksumBytesRemaining > 0) {
+            const auto byte = this->readByte();
+
+            if (!byte.has_value()) {
+                throw Exceptions::Exception("Timed out waiting for packet from server");
+            }
+
+            output.push_back(*byte);
+
+            if (checksumBytesRemaining.has_value()) {
+                --(*checksumBytesRemaining);
+
+            } else if (*byte == '#') {
+                checksumBytesRemaining = 2;
+            }
+        }
+
+        return output;
+    }
+
+    void disconnect() {
+        if (this->socketFileDescriptor >= 0) {
+            ::close(this->socketFileDescriptor);
+            this->socketFileDescriptor = -1;
+        }
+    }
+
+private:
+    int socketFileDescriptor = -1;
+
+    std::string buffer;
+    std::size_t bufferPosition = 0;
+};
@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "src/DebugToolDrivers/Microchip/Protocols/EDBG/AVR/RegisterReadPlanner.hpp"
+
+namespace
+{
+    using DebugToolDrivers::Microchip::Protocols::Edbg::Avr::RegisterReadPlanner;
+    using Targets::TargetRegisterDescriptor;
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemorySize;
+
+    /**
+     * Generates register descriptors resembling those of an ATmega2560: the GP registers, a densely populated I/O
+     * block (0x20 - 0xFF), and sparsely populated extended I/O (0x100 - 0x1FF). The seed is fixed, so that results
+     * are comparable across runs.
+     */
+    std::vector<TargetRegisterDescriptor> registerDescriptors() {
+        auto generator = std::mt19937(0xB100B);
+        auto descriptors = std::vector<TargetRegisterDescriptor>();
+
+        const auto addDescriptor = [&descriptors] (TargetMemoryAddress startAddress, TargetMemorySize size) {
+            descriptors.emplace_back(
+                Targets::TargetRegisterType::OTHER,
+                startAddress,
+                size,
+                Targets::TargetMemoryType::RAM,
+                std::nullopt,
+                std::nullopt,
+                std::nullopt,
+                Targets::TargetRegisterAccess(true, true)
+            );
+        };
+
+        addDescriptor(0x00, 32);
+
+        auto populated = std::bernoulli_distribution(0.8);
+        for (auto address = TargetMemoryAddress{0x20}; address <= 0xFF; ++address) {
+            if (populated(generator)) {
+                addDescriptor(address, 1);
+            }
+        }
+
+        auto sparselyPopulated = std::bernoulli_distribution(0.15);
+        for (auto address = TargetMemoryAddress{0x100}; address <= 0x1FF; address += 2) {
+            if (sparselyPopulated(generator)) {
+                addDescriptor(address, 2);
+            }
+        }
+
+        return descriptors;
+    }
+
+    /**
+     * Plans the reads for every register, with a maximum gap size of state.range(0).
+     *
+     * Aside from the time taken to plan, the number of reads and the number of bytes read are reported, as these
+     * determine the cost of reading the registers from the target.
+     */
+    void planReadRanges(benchmark::State& state) {
+        const auto descriptors = registerDescriptors();
+        const auto maximumGapSize = static_cast<TargetMemorySize>(state.range(0));
+
+        auto sortedDescriptors = std::vector<const TargetRegisterDescriptor*>();
+        for (const auto& descriptor : descriptors) {
+            sortedDescriptors.push_back(&descriptor);
+        }
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(RegisterReadPlanner::planReadRanges(sortedDescriptors, maximumGapSize));
+        }
+
+        const auto ranges = RegisterReadPlanner::planReadRanges(sortedDescriptors, maximumGapSize);
+
+        auto bytes = std::size_t{0};
+        for (const auto& range : ranges) {
+            bytes += range.endAddress - range.startAddress + 1;
+        }
+
+        state.counters["registers"] = static_cast<double>(descriptors.size());
+        state.counters["reads"] = static_cast<double>(ranges.size());
+        state.counters["bytes"] = static_cast<double>(bytes);
+    }
+
+    // No gaps bridged, the gap size for a 64-byte HID report, and every gap bridged (a single read)
+    BENCHMARK(planReadRanges)->ArgName("maximumGapSize")->Arg(0)->Arg(34)->Arg(64 * 1024);
+}
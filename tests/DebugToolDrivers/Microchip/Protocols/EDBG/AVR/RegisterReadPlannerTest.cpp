@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+#include "src/DebugToolDrivers/Microchip/Protocols/EDBG/AVR/RegisterReadPlanner.hpp"
+
+namespace
+{
+    using DebugToolDrivers::Microchip::Protocols::Edbg::Avr::RegisterReadPlanner;
+    using Targets::TargetRegisterDescriptor;
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemoryAddressRange;
+    using Targets::TargetMemorySize;
+
+    /**
+     * The gap size used by EdbgAvr8Interface::planRegisterReadRanges() for a 64-byte HID report.
+     */
+    constexpr auto MAXIMUM_GAP_SIZE = TargetMemorySize{34};
+
+    class RegisterReadPlannerTest: public ::testing::Test
+    {
+    protected:
+        std::vector<TargetRegisterDescriptor> descriptors;
+
+        /**
+         * Constructs a descriptor for each (start address, size) pair, in the given order (which must be sorted by
+         * start address), and plans the reads.
+         */
+        std::vector<TargetMemoryAddressRange> plan(
+            const std::vector<std::pair<TargetMemoryAddress, TargetMemorySize>>& registers,
+            TargetMemorySize maximumGapSize = MAXIMUM_GAP_SIZE
+        ) {
+            this->descriptors.clear();
+            this->descriptors.reserve(registers.size());
+
+            for (const auto& [startAddress, size] : registers) {
+                this->descriptors.emplace_back(
+                    Targets::TargetRegisterType::OTHER,
+                    startAddress,
+                    size,
+                    Targets::TargetMemoryType::RAM,
+                    std::nullopt,
+                    std::nullopt,
+                    std::nullopt,
+                    Targets::TargetRegisterAccess(true, true)
+                );
+            }
+
+            auto sortedDescriptors = std::vector<const TargetRegisterDescriptor*>();
+            for (const auto& descriptor : this->descriptors) {
+                sortedDescriptors.push_back(&descriptor);
+            }
+
+            return RegisterReadPlanner::planReadRanges(sortedDescriptors, maximumGapSize);
+        }
+    };
+
+    TEST_F(RegisterReadPlannerTest, NoRegisters) {
+        EXPECT_TRUE(this->plan({}).empty());
+    }
+
+    TEST_F(RegisterReadPlannerTest, SingleRegister) {
+        EXPECT_EQ(this->plan({{0x5D, 2}}), std::vector<TargetMemoryAddressRange>({{0x5D, 0x5E}}));
+    }
+
+    TEST_F(RegisterReadPlannerTest, ContiguousRegistersAreMerged) {
+        EXPECT_EQ(
+            this->plan({{0x20, 1}, {0x21, 1}, {0x22, 2}, {0x24, 4}}),
+            std::vector<TargetMemoryAddressRange>({{0x20, 0x27}})
+        );
+    }
+
+    TEST_F(RegisterReadPlannerTest, GapsUpToTheMaximumAreBridged) {
+        // 34 unused bytes between the registers (0x21 to 0x42 inclusive)
+        EXPECT_EQ(
+            this->plan({{0x20, 1}, {0x43, 1}}),
+            std::vector<TargetMemoryAddressRange>({{0x20, 0x43}})
+        );
+    }
+
+    TEST_F(RegisterReadPlannerTest, GapsLargerThanTheMaximumAreSplit) {
+        // 35 unused bytes between the registers (0x21 to 0x43 inclusive)
+        EXPECT_EQ(
+            this->plan({{0x20, 1}, {0x44, 1}}),
+            std::vector<TargetMemoryAddressRange>({{0x20, 0x20}, {0x44, 0x44}})
+        );
+    }
+
+    TEST_F(RegisterReadPlannerTest, GapIsMeasuredFromTheEndOfMultiByteRegisters) {
+        // The first register ends at 0x23, leaving a 34 byte gap, and then a 35 byte gap
+        EXPECT_EQ(
+            this->plan({{0x20, 4}, {0x46, 2}, {0x6B, 1}}),
+            std::vector<TargetMemoryAddressRange>({{0x20, 0x47}, {0x6B, 0x6B}})
+        );
+    }
+
+    TEST_F(RegisterReadPlannerTest, OverlappingRegistersAreMerged) {
+        // A 16-bit register, followed by its low and high bytes, and a register nested within a wider one
+        EXPECT_EQ(
+            this->plan({{0x84, 2}, {0x84, 1}, {0x85, 1}, {0x100, 4}, {0x101, 1}}, 0),
+            std::vector<TargetMemoryAddressRange>({{0x84, 0x85}, {0x100, 0x103}})
+        );
+    }
+
+    TEST_F(RegisterReadPlannerTest, ZeroGapSizeOnlyMergesAdjacentRegisters) {
+        EXPECT_EQ(
+            this->plan({{0x20, 1}, {0x21, 1}, {0x23, 1}}, 0),
+            std::vector<TargetMemoryAddressRange>({{0x20, 0x21}, {0x23, 0x23}})
+        );
+    }
+
+    TEST_F(RegisterReadPlannerTest, ScatteredRegisters) {
+        // Typical of an ATmega: GP registers, a dense I/O block, and a few extended I/O registers far apart
+        EXPECT_EQ(
+            this->plan({{0x00, 32}, {0x23, 1}, {0x5D, 2}, {0x5F, 1}, {0x120, 1}, {0x130, 2}, {0x800, 1}}),
+            std::vector<TargetMemoryAddressRange>({{0x00, 0x23}, {0x5D, 0x5F}, {0x120, 0x131}, {0x800, 0x800}})
+        );
+    }
+}
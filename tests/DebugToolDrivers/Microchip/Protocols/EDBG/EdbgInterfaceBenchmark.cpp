@@ -0,0 +1,196 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+#include <deque>
+#include <span>
+#include <chrono>
+#include <algorithm>
+
+#include "src/DebugToolDrivers/Microchip/Protocols/EDBG/EdbgInterface.hpp"
+#include "src/DebugToolDrivers/Microchip/Protocols/EDBG/AVR/CommandFrames/AVR8Generic/ReadMemory.hpp"
+
+/*
+ * These benchmarks measure the time taken to read memory from an EDBG tool, with and without command pipelining.
+ *
+ * The USB HID interface is replaced with a mock (see tests/Mocks), which passes reports to a simulated EDBG device
+ * and accumulates the time the transfers would have taken on a simulated clock. The reported times are taken from
+ * that clock (via UseManualTime()), not from the wall clock.
+ *
+ * The minimum command time gap (35ms for EDBG tools - see EdbgDevice::init()) is not applied here, as it's enforced
+ * in real time. With the gap, every command in lockstep mode would cost a further 35ms, whereas a pipelined batch
+ * only pays it once - so these figures understate the difference.
+ */
+namespace
+{
+    using DebugToolDrivers::Microchip::Protocols::Edbg::EdbgInterface;
+    using DebugToolDrivers::Microchip::Protocols::Edbg::Avr::Avr8MemoryType;
+    using DebugToolDrivers::Microchip::Protocols::Edbg::Avr::CommandFrames::Avr8Generic::ReadMemory;
+
+    /**
+     * The size of an ATmega644's program memory.
+     */
+    constexpr auto MEMORY_SIZE = std::uint32_t{64 * 1024};
+
+    constexpr auto REPORT_SIZE = std::uint16_t{64};
+
+    /**
+     * We assume the tool takes 100us to process each report. This includes reading from the target, for AVR_CMD
+     * reports.
+     */
+    constexpr auto REPORT_PROCESSING_DURATION = std::chrono::microseconds(100);
+
+    /**
+     * Simulates an EDBG device servicing AVR8 Generic read memory commands.
+     *
+     * AVR_CMD reports carry fragments of an AVR command frame. Once the last fragment has been received, the device
+     * prepares the response frame, which the host then fetches one fragment at a time, via AVR_RSP reports.
+     */
+    class SimulatedEdbgDevice
+    {
+    public:
+        std::vector<unsigned char> operator () (std::span<const unsigned char> report) {
+            switch (report[0]) {
+                case AVR_COMMAND_ID: {
+                    return this->receiveCommandFragment(report);
+                }
+                case AVR_RESPONSE_ID: {
+                    return this->sendResponseFragment();
+                }
+                default: {
+                    return {report[0]};
+                }
+            }
+        }
+
+    private:
+        static constexpr auto AVR_COMMAND_ID = static_cast<unsigned char>(0x80);
+        static constexpr auto AVR_RESPONSE_ID = static_cast<unsigned char>(0x81);
+
+        /**
+         * An AVR_RSP report consists of the response ID, the fragment info byte and two size bytes.
+         */
+        static constexpr auto RESPONSE_PACKET_SIZE = std::size_t{REPORT_SIZE - 4};
+
+        std::vector<unsigned char> commandFrame;
+        std::deque<std::vector<unsigned char>> responsePackets;
+        std::size_t responseFragmentCount = 0;
+
+        std::vector<unsigned char> receiveCommandFragment(std::span<const unsigned char> report) {
+            const auto fragmentCount = report[1] & 0x0FU;
+            const auto fragmentNumber = report[1] >> 4U;
+            const auto packetSize = static_cast<std::size_t>((report[2] << 8U) | report[3]);
+
+            this->commandFrame.insert(this->commandFrame.end(), report.begin() + 4, report.begin() + 4 + packetSize);
+
+            if (fragmentNumber == fragmentCount) {
+                this->prepareResponseFrame();
+                this->commandFrame.clear();
+            }
+
+            return {AVR_COMMAND_ID, 0x01};
+        }
+
+        void prepareResponseFrame() {
+            // SOF byte, sequence ID and protocol handler ID - the command frame also carries a protocol version byte
+            auto responseFrame = std::vector<unsigned char>({
+                0x0E,
+                this->commandFrame[2],
+                this->commandFrame[3],
+                this->commandFrame[4],
+            });
+
+            const auto commandPayload = std::span(this->commandFrame).subspan(5);
+
+            if (commandPayload[0] == 0x21) {
+                // Read memory - respond with the requested number of bytes, followed by a status byte
+                const auto bytes = static_cast<std::size_t>(
+                    commandPayload[7] | (commandPayload[8] << 8U) | (commandPayload[9] << 16U)
+                        | (commandPayload[10] << 24U)
+                );
+
+                responseFrame.reserve(responseFrame.size() + bytes + 3);
+                responseFrame.push_back(0x84);
+                responseFrame.push_back(0x00);
+                responseFrame.insert(responseFrame.end(), bytes, 0xAA);
+                responseFrame.push_back(0x00);
+
+            } else {
+                responseFrame.push_back(0x80);
+                responseFrame.push_back(0x00);
+            }
+
+            this->responsePackets.clear();
+            for (auto packetIt = responseFrame.begin(); packetIt != responseFrame.end();) {
+                const auto packetEndIt = packetIt + static_cast<std::ptrdiff_t>(
+                    std::min(RESPONSE_PACKET_SIZE, static_cast<std::size_t>(responseFrame.end() - packetIt))
+                );
+
+                this->responsePackets.emplace_back(packetIt, packetEndIt);
+                packetIt = packetEndIt;
+            }
+
+            this->responseFragmentCount = this->responsePackets.size();
+        }
+
+        std::vector<unsigned char> sendResponseFragment() {
+            if (this->responsePackets.empty()) {
+                return {AVR_RESPONSE_ID, 0x00};
+            }
+
+            const auto& packet = this->responsePackets.front();
+            const auto fragmentNumber = this->responseFragmentCount - this->responsePackets.size() + 1;
+
+            auto report = std::vector<unsigned char>({
+                AVR_RESPONSE_ID,
+                static_cast<unsigned char>((fragmentNumber << 4) | this->responseFragmentCount),
+                static_cast<unsigned char>(packet.size() >> 8),
+                static_cast<unsigned char>(packet.size()),
+            });
+            report.insert(report.end(), packet.begin(), packet.end());
+
+            this->responsePackets.pop_front();
+            return report;
+        }
+    };
+
+    /**
+     * Reads the whole of program memory, in reads of state.range(0) bytes, with a maximum of state.range(1)
+     * pipelined commands (1 being lockstep).
+     */
+    void readMemory(benchmark::State& state) {
+        const auto readSize = static_cast<std::uint32_t>(state.range(0));
+
+        auto edbgInterface = EdbgInterface(Usb::HidInterface(0, REPORT_SIZE, 0x03EB, 0x2141));
+        edbgInterface.setMaximumPipelinedCommands(static_cast<std::uint8_t>(state.range(1)));
+
+        auto& hidInterface = edbgInterface.getUsbHidInterface();
+        hidInterface.device = SimulatedEdbgDevice();
+        hidInterface.reportProcessingDuration = REPORT_PROCESSING_DURATION;
+
+        for (auto _ : state) {
+            hidInterface.reset();
+
+            for (auto address = std::uint32_t{0}; address < MEMORY_SIZE; address += readSize) {
+                const auto responseFrame = edbgInterface.sendAvrCommandFrameAndWaitForResponseFrame(
+                    ReadMemory(Avr8MemoryType::FLASH_PAGE, address, readSize)
+                );
+
+                if (responseFrame.getMemoryData().size() != readSize) {
+                    state.SkipWithError("Unexpected read memory response");
+                    return;
+                }
+            }
+
+            state.SetIterationTime(std::chrono::duration<double>(hidInterface.elapsed).count());
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * MEMORY_SIZE);
+    }
+
+    BENCHMARK(readMemory)
+        ->ArgNames({"readSize", "pipelinedCommands"})
+        ->ArgsProduct({{256, 512}, {1, 4, 8}})
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <deque>
+#include <span>
+#include <optional>
+#include <chrono>
+#include <functional>
+#include <algorithm>
+
+namespace Usb
+{
+    /**
+     * A stand-in for the HIDAPI-backed HidInterface, for the tests and benchmarks. It shadows the real
+     * src/DebugToolDrivers/USB/HID/HidInterface.hpp, via the include paths.
+     *
+     * Reports are handed to a simulated device (HidInterface::device), which returns a single response report for
+     * each report it receives. No real time passes - the time taken by each transfer is accumulated on a simulated
+     * clock (HidInterface::elapsed), modelled on a full-speed USB device with a 1ms polling interval:
+     *  - At most one report can be transferred in each direction, per frame.
+     *  - Writes block until the report has been transferred.
+     *  - The device processes reports in the order in which they were received, one at a time.
+     *  - Response reports are transferred to the host as soon as they're ready, regardless of when the host reads
+     *    them (as HIDAPI's libusb backend does, via its own read thread).
+     */
+    class HidInterface
+    {
+    public:
+        using Clock = std::chrono::nanoseconds;
+
+        static constexpr auto FRAME_DURATION = Clock(std::chrono::milliseconds(1));
+
+        std::uint8_t interfaceNumber = 0;
+        std::uint16_t inputReportSize = 64;
+
+        /**
+         * The simulated device. Takes a report from the host and returns the response report.
+         */
+        std::function<std::vector<unsigned char>(std::span<const unsigned char>)> device;
+
+        /**
+         * The time the simulated device takes to process each report.
+         */
+        Clock reportProcessingDuration = Clock(0);
+
+        /**
+         * Time elapsed on the simulated clock.
+         */
+        Clock elapsed = Clock(0);
+
+        HidInterface(
+            std::uint8_t interfaceNumber,
+            std::uint16_t inputReportSize,
+            std::uint16_t vendorId,
+            std::uint16_t productId
+        )
+            : interfaceNumber(interfaceNumber)
+            , inputReportSize(inputReportSize)
+            , vendorId(vendorId)
+            , productId(productId)
+        {}
+
+        HidInterface(const HidInterface& other) = delete;
+        HidInterface& operator = (const HidInterface& other) = delete;
+
+        HidInterface(HidInterface&& other) = default;
+        HidInterface& operator = (HidInterface&& other) = default;
+
+        void init() {}
+
+        void close() {}
+
+        /**
+         * Resets the simulated clock. Any responses that have not been read will be discarded.
+         */
+        void reset() {
+            this->elapsed = Clock(0);
+            this->nextOutputTransferTime = Clock(0);
+            this->nextInputTransferTime = Clock(0);
+            this->deviceAvailableTime = Clock(0);
+            this->pendingReports.clear();
+        }
+
+        std::span<const unsigned char> read(std::optional<std::chrono::milliseconds> timeout = std::nullopt) {
+            return this->readReport(timeout);
+        }
+
+        std::span<const unsigned char> readReport(std::optional<std::chrono::milliseconds> timeout = std::nullopt) {
+            if (this->pendingReports.empty()) {
+                if (timeout.has_value()) {
+                    this->elapsed += *timeout;
+                }
+
+                return {};
+            }
+
+            auto& pendingReport = this->pendingReports.front();
+            this->elapsed = std::max(this->elapsed, pendingReport.arrivalTime);
+
+            this->inputBuffer = std::move(pendingReport.data);
+            this->pendingReports.pop_front();
+
+            return this->inputBuffer;
+        }
+
+        void write(std::span<const unsigned char> buffer) {
+            const auto transferTime = std::max(this->elapsed, this->nextOutputTransferTime);
+            this->nextOutputTransferTime = transferTime + HidInterface::FRAME_DURATION;
+            this->elapsed = this->nextOutputTransferTime;
+
+            const auto processingStartTime = std::max(this->elapsed, this->deviceAvailableTime);
+            this->deviceAvailableTime = processingStartTime + this->reportProcessingDuration;
+
+            const auto responseTransferTime = std::max(this->deviceAvailableTime, this->nextInputTransferTime);
+            this->nextInputTransferTime = responseTransferTime + HidInterface::FRAME_DURATION;
+
+            this->pendingReports.emplace_back(PendingReport{
+                .arrivalTime = this->nextInputTransferTime,
+                .data = this->device(buffer),
+            });
+        }
+
+        std::string getHidDevicePath() {
+            return "mock";
+        }
+
+        std::uint16_t getVendorId() const {
+            return this->vendorId;
+        }
+
+        std::uint16_t getProductId() const {
+            return this->productId;
+        }
+
+    private:
+        struct PendingReport
+        {
+            Clock arrivalTime;
+            std::vector<unsigned char> data;
+        };
+
+        std::uint16_t vendorId = 0;
+        std::uint16_t productId = 0;
+
+        Clock nextOutputTransferTime = Clock(0);
+        Clock nextInputTransferTime = Clock(0);
+        Clock deviceAvailableTime = Clock(0);
+
+        std::deque<PendingReport> pendingReports;
+        std::vector<unsigned char> inputBuffer;
+    };
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+/**
+ * A stand-in for the Logger, for the tests and benchmarks. It shadows the real src/Logger/Logger.hpp, via the include
+ * paths, as the real Logger depends on Qt and the project config.
+ *
+ * All messages are discarded.
+ */
+class Logger
+{
+public:
+    static void silence() {}
+
+    static void info(const std::string& message) {}
+
+    static void warning(const std::string& message) {}
+
+    static void error(const std::string& message) {}
+
+    static void debug(const std::string& message) {}
+};
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <random>
+
+#include "src/Services/StringService.hpp"
+
+namespace
+{
+    using Services::StringService;
+
+    /**
+     * Generates pseudo-random data of the given size. The seed is fixed, so that results are comparable across runs.
+     */
+    std::vector<unsigned char> randomData(std::size_t size) {
+        auto generator = std::mt19937(0xB100B);
+        auto distribution = std::uniform_int_distribution<unsigned int>(0x00, 0xFF);
+
+        auto data = std::vector<unsigned char>(size);
+
+        for (auto& byte : data) {
+            byte = static_cast<unsigned char>(distribution(generator));
+        }
+
+        return data;
+    }
+
+    /**
+     * Encodes into a reused buffer, as the GDB server does when building memory read response packets.
+     */
+    void appendHex(benchmark::State& state) {
+        const auto data = randomData(static_cast<std::size_t>(state.range(0)));
+        auto output = std::vector<unsigned char>();
+        output.reserve(data.size() * 2);
+
+        for (auto _ : state) {
+            output.clear();
+            StringService::appendHex(data, output);
+            benchmark::DoNotOptimize(output.data());
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    }
+
+    void dataFromHex(benchmark::State& state) {
+        const auto hexData = StringService::toHex(randomData(static_cast<std::size_t>(state.range(0))));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(StringService::dataFromHex(hexData));
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    }
+
+    void uint32FromHex(benchmark::State& state) {
+        auto generator = std::mt19937(0xB100B);
+        auto values = std::vector<std::string>(1024);
+
+        for (auto& value : values) {
+            value = StringService::toHex(static_cast<std::uint32_t>(generator()));
+        }
+
+        for (auto _ : state) {
+            for (const auto& value : values) {
+                benchmark::DoNotOptimize(StringService::uint32FromHex(value));
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * values.size()));
+    }
+
+    BENCHMARK(appendHex)->Arg(64)->Arg(4 * 1024);
+    BENCHMARK(dataFromHex)->Arg(64)->Arg(4 * 1024);
+    BENCHMARK(uint32FromHex);
+}
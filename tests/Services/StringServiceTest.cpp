@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cctype>
+#include <string>
+#include <vector>
+#include <random>
+
+#include "src/Services/StringService.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace
+{
+    using Services::StringService;
+
+    /**
+     * The seed is fixed, so that failures can be reproduced.
+     */
+    constexpr auto RANDOM_SEED = std::mt19937::result_type{0xB100B};
+
+    /**
+     * Encodes the given data via snprintf(), as a reference for the table-driven encoder.
+     */
+    std::string referenceHex(const std::vector<unsigned char>& data) {
+        auto output = std::string();
+
+        for (const auto byte : data) {
+            char digits[3];
+            std::snprintf(digits, sizeof(digits), "%02x", byte);
+            output += digits;
+        }
+
+        return output;
+    }
+
+    std::vector<unsigned char> randomData(std::mt19937& generator, std::size_t size) {
+        auto distribution = std::uniform_int_distribution<unsigned int>(0x00, 0xFF);
+        auto data = std::vector<unsigned char>(size);
+
+        for (auto& byte : data) {
+            byte = static_cast<unsigned char>(distribution(generator));
+        }
+
+        return data;
+    }
+
+    TEST(StringServiceTest, HexDataRoundTrip) {
+        auto generator = std::mt19937(RANDOM_SEED);
+        auto sizeDistribution = std::uniform_int_distribution<std::size_t>(0, 512);
+
+        for (auto i = 0; i < 1000; ++i) {
+            const auto data = randomData(generator, sizeDistribution(generator));
+            const auto expectedHex = referenceHex(data);
+
+            // Appending must preserve whatever is already in the output buffer
+            auto output = std::vector<unsigned char>({'$'});
+            StringService::appendHex(data, output);
+
+            ASSERT_EQ(std::string(output.begin() + 1, output.end()), expectedHex);
+            ASSERT_EQ(StringService::toHex(data), expectedHex);
+            ASSERT_EQ(StringService::dataFromHex(expectedHex), data);
+            ASSERT_EQ(StringService::dataFromHex(StringService::asciiToUpper(expectedHex)), data);
+        }
+    }
+
+    TEST(StringServiceTest, EveryByteValueRoundTrips) {
+        for (auto value = 0; value <= 0xFF; ++value) {
+            const auto byte = static_cast<unsigned char>(value);
+
+            EXPECT_EQ(StringService::toHex(byte), referenceHex({byte}));
+            EXPECT_EQ(StringService::dataFromHex(StringService::toHex(byte)), std::vector<unsigned char>({byte}));
+        }
+    }
+
+    TEST(StringServiceTest, InvalidHexDataIsRejected) {
+        EXPECT_TRUE(StringService::dataFromHex("").empty());
+        EXPECT_THROW(StringService::dataFromHex("a"), Exceptions::Exception);
+        EXPECT_THROW(StringService::dataFromHex("abc"), Exceptions::Exception);
+
+        // Every non-hexadecimal character must be rejected, in either position of the byte
+        for (auto value = 0; value <= 0xFF; ++value) {
+            const auto character = static_cast<char>(value);
+
+            if (std::isxdigit(value)) {
+                continue;
+            }
+
+            SCOPED_TRACE(::testing::Message() << "Character: 0x" << std::hex << value);
+
+            EXPECT_THROW(StringService::dataFromHex(std::string({character, '0'})), Exceptions::Exception);
+            EXPECT_THROW(StringService::dataFromHex(std::string({'0', character})), Exceptions::Exception);
+            EXPECT_THROW(StringService::dataFromHex(std::string({'f', 'f', character, 'f'})), Exceptions::Exception);
+        }
+    }
+
+    TEST(StringServiceTest, Uint32HexRoundTrip) {
+        auto generator = std::mt19937(RANDOM_SEED);
+        auto distribution = std::uniform_int_distribution<std::uint32_t>();
+
+        for (auto i = 0; i < 10000; ++i) {
+            const auto value = distribution(generator);
+
+            char digits[9];
+            std::snprintf(digits, sizeof(digits), "%x", value);
+
+            ASSERT_EQ(StringService::uint32FromHex(StringService::toHex(value)), value);
+            ASSERT_EQ(StringService::uint32FromHex(digits), value);
+            ASSERT_EQ(StringService::uint32FromHex(StringService::asciiToUpper(digits)), value);
+        }
+    }
+
+    TEST(StringServiceTest, Uint32HexBoundaries) {
+        EXPECT_EQ(StringService::uint32FromHex("0"), 0);
+        EXPECT_EQ(StringService::uint32FromHex("ffffffff"), 0xFFFFFFFF);
+
+        // Leading zeros don't count towards the 32 bits
+        EXPECT_EQ(StringService::uint32FromHex("0000000000000001"), 1);
+        EXPECT_EQ(StringService::uint32FromHex("00ffffffff"), 0xFFFFFFFF);
+
+        EXPECT_THROW(StringService::uint32FromHex(""), Exceptions::Exception);
+        EXPECT_THROW(StringService::uint32FromHex("100000000"), Exceptions::Exception);
+        EXPECT_THROW(StringService::uint32FromHex("fffffffff"), Exceptions::Exception);
+        EXPECT_THROW(StringService::uint32FromHex("12g4"), Exceptions::Exception);
+        EXPECT_THROW(StringService::uint32FromHex("-1"), Exceptions::Exception);
+        EXPECT_THROW(StringService::uint32FromHex("0x10"), Exceptions::Exception);
+    }
+}
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+
+#include "src/Targets/Microchip/AVR/AVR8/OpcodeDecoder/Decoder.hpp"
+
+namespace
+{
+    using Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder::Decoder;
+    using Targets::TargetMemoryBuffer;
+
+    /**
+     * Generates pseudo-random program memory of the given size. The seed is fixed, so that results are comparable
+     * across runs.
+     */
+    TargetMemoryBuffer programMemory(std::size_t size) {
+        auto generator = std::mt19937(0xB100B);
+        auto distribution = std::uniform_int_distribution<unsigned int>(0x00, 0xFF);
+
+        auto data = TargetMemoryBuffer(size);
+
+        for (auto& byte : data) {
+            byte = static_cast<unsigned char>(distribution(generator));
+        }
+
+        return data;
+    }
+
+    void decode(benchmark::State& state) {
+        const auto data = programMemory(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Decoder::decode(0x00, data));
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    }
+
+    void decodeStream(benchmark::State& state) {
+        const auto data = programMemory(static_cast<std::size_t>(state.range(0)));
+
+        for (auto _ : state) {
+            benchmark::DoNotOptimize(Decoder::decodeStream(0x00, data));
+        }
+
+        state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    }
+
+    BENCHMARK(decode)->Arg(16 * 1024)->Arg(256 * 1024);
+    BENCHMARK(decodeStream)->Arg(16 * 1024)->Arg(256 * 1024);
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <array>
+#include <optional>
+
+#include "src/Targets/Microchip/AVR/AVR8/OpcodeDecoder/Decoder.hpp"
+
+namespace Targets::Microchip::Avr::Avr8Bit::OpcodeDecoder
+{
+    class DecoderTest: public ::testing::Test
+    {
+    protected:
+        static std::optional<Instruction> decodeInstruction(const TargetMemoryBuffer& data) {
+            return Decoder::decodeInstruction(data.begin(), data.end());
+        }
+
+        /**
+         * Decodes the instruction at the beginning of the given data by trying each opcode decoder in order, as the
+         * decoder did before the dispatch table was introduced. This is the reference implementation that the
+         * dispatch table lookup must agree with.
+         */
+        static std::optional<Instruction> decodeInstructionLinearly(const TargetMemoryBuffer& data) {
+            const auto firstWord = static_cast<std::uint16_t>(data[1] << 8 | data[0]);
+
+            for (const auto& decoder : Decoder::orderedOpcodeDecoders()) {
+                if ((firstWord & decoder.firstWordMask) != decoder.firstWordOpcode) {
+                    continue;
+                }
+
+                auto instruction = decoder.decode(data.begin(), data.end());
+
+                if (instruction.has_value()) {
+                    return instruction;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        static void expectEqual(
+            const std::optional<Instruction>& instruction,
+            const std::optional<Instruction>& expectedInstruction
+        ) {
+            ASSERT_EQ(instruction.has_value(), expectedInstruction.has_value());
+
+            if (!expectedInstruction.has_value()) {
+                return;
+            }
+
+            EXPECT_EQ(instruction->name, expectedInstruction->name);
+            EXPECT_EQ(instruction->opcode, expectedInstruction->opcode);
+            EXPECT_EQ(instruction->byteSize, expectedInstruction->byteSize);
+            EXPECT_EQ(instruction->mnemonic, expectedInstruction->mnemonic);
+            EXPECT_EQ(instruction->canChangeProgramFlow, expectedInstruction->canChangeProgramFlow);
+            EXPECT_EQ(instruction->data, expectedInstruction->data);
+            EXPECT_EQ(instruction->sourceRegister, expectedInstruction->sourceRegister);
+            EXPECT_EQ(instruction->destinationRegister, expectedInstruction->destinationRegister);
+            EXPECT_EQ(instruction->programWordAddress, expectedInstruction->programWordAddress);
+            EXPECT_EQ(instruction->programWordAddressOffset, expectedInstruction->programWordAddressOffset);
+            EXPECT_EQ(instruction->canSkipNextInstruction, expectedInstruction->canSkipNextInstruction);
+            EXPECT_EQ(instruction->registerBitPosition, expectedInstruction->registerBitPosition);
+            EXPECT_EQ(instruction->statusRegisterBitPosition, expectedInstruction->statusRegisterBitPosition);
+            EXPECT_EQ(instruction->ioSpaceAddress, expectedInstruction->ioSpaceAddress);
+            EXPECT_EQ(instruction->dataSpaceAddress, expectedInstruction->dataSpaceAddress);
+            EXPECT_EQ(instruction->displacement, expectedInstruction->displacement);
+        }
+    };
+
+    TEST_F(DecoderTest, DispatchTableMatchesLinearSearchForSingleWords) {
+        /*
+         * With only one word available, any 32-bit instruction decoders will fail, forcing the decoder to fall back
+         * to the subsequent decoders.
+         */
+        for (auto word = std::uint32_t{0}; word <= 0xFFFF; ++word) {
+            SCOPED_TRACE(::testing::Message() << "First word: 0x" << std::hex << word);
+
+            const auto data = TargetMemoryBuffer({
+                static_cast<unsigned char>(word),
+                static_cast<unsigned char>(word >> 8),
+            });
+
+            DecoderTest::expectEqual(
+                DecoderTest::decodeInstruction(data),
+                DecoderTest::decodeInstructionLinearly(data)
+            );
+
+            if (::testing::Test::HasFatalFailure()) {
+                return;
+            }
+        }
+    }
+
+    TEST_F(DecoderTest, DispatchTableMatchesLinearSearchWithSecondWords) {
+        static constexpr auto SECOND_WORDS = std::array<std::uint16_t, 5>({0x0000, 0xFFFF, 0x1234, 0x8001, 0xA5C3});
+
+        for (auto word = std::uint32_t{0}; word <= 0xFFFF; ++word) {
+            for (const auto secondWord : SECOND_WORDS) {
+                SCOPED_TRACE(
+                    ::testing::Message() << "First word: 0x" << std::hex << word << ", second word: 0x" << secondWord
+                );
+
+                const auto data = TargetMemoryBuffer({
+                    static_cast<unsigned char>(word),
+                    static_cast<unsigned char>(word >> 8),
+                    static_cast<unsigned char>(secondWord),
+                    static_cast<unsigned char>(secondWord >> 8),
+                });
+
+                DecoderTest::expectEqual(
+                    DecoderTest::decodeInstruction(data),
+                    DecoderTest::decodeInstructionLinearly(data)
+                );
+
+                if (::testing::Test::HasFatalFailure()) {
+                    return;
+                }
+            }
+        }
+    }
+
+    TEST_F(DecoderTest, DecodeStreamMatchesDecode) {
+        auto data = TargetMemoryBuffer();
+        data.reserve(0x20000);
+
+        for (auto word = std::uint32_t{0}; word <= 0xFFFF; ++word) {
+            data.push_back(static_cast<unsigned char>(word));
+            data.push_back(static_cast<unsigned char>(word >> 8));
+        }
+
+        const auto instructions = Decoder::decode(0x00, data);
+        const auto stream = Decoder::decodeStream(0x00, data);
+
+        for (const auto& [byteAddress, instruction] : instructions) {
+            SCOPED_TRACE(::testing::Message() << "Byte address: 0x" << std::hex << byteAddress);
+
+            DecoderTest::expectEqual(Decoder::instruction(stream.records[byteAddress / 2]), instruction);
+
+            if (::testing::Test::HasFatalFailure()) {
+                return;
+            }
+        }
+    }
+}
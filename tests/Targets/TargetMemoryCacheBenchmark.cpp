@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "src/Targets/TargetMemoryCache.hpp"
+
+namespace
+{
+    using Targets::TargetMemoryCache;
+    using Targets::TargetMemoryDescriptor;
+    using Targets::TargetMemoryAddressRange;
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemoryBuffer;
+
+    /**
+     * The size of an ATmega2560's program memory.
+     */
+    constexpr auto MEMORY_SIZE = TargetMemoryAddress{256 * 1024};
+
+    /**
+     * GDB reads 4 bytes at a time when unwinding the stack.
+     */
+    constexpr auto ACCESS_SIZE = Targets::TargetMemorySize{4};
+
+    TargetMemoryDescriptor memoryDescriptor() {
+        return TargetMemoryDescriptor(
+            Targets::TargetMemoryType::FLASH,
+            TargetMemoryAddressRange(0x00, MEMORY_SIZE - 1),
+            Targets::TargetMemoryAccess(true, true, false),
+            256
+        );
+    }
+
+    /**
+     * Generates pseudo-random, word-aligned access addresses. The seed is fixed, so that results are comparable
+     * across runs.
+     */
+    std::vector<TargetMemoryAddress> scatteredAddresses(std::size_t count) {
+        auto generator = std::mt19937(0xB100B);
+        auto distribution = std::uniform_int_distribution<TargetMemoryAddress>(0, (MEMORY_SIZE - ACCESS_SIZE) / 2);
+
+        auto addresses = std::vector<TargetMemoryAddress>(count);
+
+        for (auto& address : addresses) {
+            address = distribution(generator) * 2;
+        }
+
+        return addresses;
+    }
+
+    void scatteredInserts(benchmark::State& state) {
+        const auto descriptor = memoryDescriptor();
+        const auto addresses = scatteredAddresses(static_cast<std::size_t>(state.range(0)));
+        const auto data = TargetMemoryBuffer(ACCESS_SIZE, 0xAA);
+
+        for (auto _ : state) {
+            auto cache = TargetMemoryCache(descriptor);
+
+            for (const auto address : addresses) {
+                cache.insert(address, data);
+            }
+
+            benchmark::DoNotOptimize(cache);
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    }
+
+    /**
+     * Each access checks the cache and fetches on a hit, or inserts on a miss - as the TargetController does when
+     * servicing GDB's reads. Half of the accesses are repeats of earlier ones.
+     */
+    void scatteredLookups(benchmark::State& state) {
+        const auto descriptor = memoryDescriptor();
+        const auto count = static_cast<std::size_t>(state.range(0));
+        auto addresses = scatteredAddresses(count / 2);
+        addresses.insert(addresses.end(), addresses.begin(), addresses.end());
+        std::shuffle(addresses.begin(), addresses.end(), std::mt19937(0xCAFE));
+
+        const auto data = TargetMemoryBuffer(ACCESS_SIZE, 0xAA);
+
+        for (auto _ : state) {
+            auto cache = TargetMemoryCache(descriptor);
+
+            for (const auto address : addresses) {
+                if (cache.contains(address, ACCESS_SIZE)) {
+                    benchmark::DoNotOptimize(cache.fetch(address, ACCESS_SIZE));
+                    continue;
+                }
+
+                cache.insert(address, data);
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+    }
+
+    /**
+     * Lookups against a cache that has been fragmented by scattered inserts, without any further inserts.
+     */
+    void fragmentedContains(benchmark::State& state) {
+        const auto descriptor = memoryDescriptor();
+        const auto addresses = scatteredAddresses(static_cast<std::size_t>(state.range(0)));
+        const auto lookupAddresses = scatteredAddresses(static_cast<std::size_t>(state.range(0)) * 2);
+        const auto data = TargetMemoryBuffer(ACCESS_SIZE, 0xAA);
+
+        auto cache = TargetMemoryCache(descriptor);
+        for (const auto address : addresses) {
+            cache.insert(address, data);
+        }
+
+        for (auto _ : state) {
+            for (const auto address : lookupAddresses) {
+                benchmark::DoNotOptimize(cache.contains(address, ACCESS_SIZE));
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * lookupAddresses.size()));
+    }
+
+    BENCHMARK(scatteredInserts)->Arg(1024)->Arg(16 * 1024);
+    BENCHMARK(scatteredLookups)->Arg(1024)->Arg(16 * 1024);
+    BENCHMARK(fragmentedContains)->Arg(1024)->Arg(16 * 1024);
+}
@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "src/Targets/TargetMemoryCache.hpp"
+#include "src/Exceptions/Exception.hpp"
+
+namespace
+{
+    using Targets::TargetMemoryCache;
+    using Targets::TargetMemoryDescriptor;
+    using Targets::TargetMemoryAddressRange;
+    using Targets::TargetMemoryAddress;
+    using Targets::TargetMemoryBuffer;
+
+    /**
+     * The memory size is deliberately not a multiple of the bitmap word size (64 bits), so that the last bitmap word
+     * is only partially used.
+     */
+    constexpr auto MEMORY_START_ADDRESS = TargetMemoryAddress{0x100};
+    constexpr auto MEMORY_SIZE = std::size_t{1000};
+
+    class TargetMemoryCacheTest: public ::testing::Test
+    {
+    protected:
+        TargetMemoryDescriptor memoryDescriptor = TargetMemoryDescriptor(
+            Targets::TargetMemoryType::RAM,
+            TargetMemoryAddressRange(
+                MEMORY_START_ADDRESS,
+                static_cast<TargetMemoryAddress>(MEMORY_START_ADDRESS + MEMORY_SIZE - 1)
+            ),
+            Targets::TargetMemoryAccess(true, true, true)
+        );
+
+        TargetMemoryCache cache = TargetMemoryCache(this->memoryDescriptor);
+
+        /**
+         * Generates a buffer of the given size, where each byte holds the low byte of its address.
+         */
+        static TargetMemoryBuffer dataAt(TargetMemoryAddress startAddress, std::size_t size) {
+            auto data = TargetMemoryBuffer(size);
+
+            for (auto i = std::size_t{0}; i < size; ++i) {
+                data[i] = static_cast<unsigned char>(startAddress + i);
+            }
+
+            return data;
+        }
+
+        void insert(TargetMemoryAddress startAddress, std::size_t size) {
+            this->cache.insert(startAddress, TargetMemoryCacheTest::dataAt(startAddress, size));
+        }
+
+        void expectFetch(TargetMemoryAddress startAddress, std::size_t size) {
+            const auto data = this->cache.fetch(startAddress, static_cast<Targets::TargetMemorySize>(size));
+            const auto expectedData = TargetMemoryCacheTest::dataAt(startAddress, size);
+
+            EXPECT_EQ(TargetMemoryBuffer(data.begin(), data.end()), expectedData);
+        }
+    };
+
+    TEST_F(TargetMemoryCacheTest, EmptyCacheContainsNothing) {
+        EXPECT_FALSE(this->cache.contains(MEMORY_START_ADDRESS, 1));
+        EXPECT_FALSE(this->cache.contains(MEMORY_START_ADDRESS, MEMORY_SIZE));
+        EXPECT_TRUE(this->cache.populatedRanges().empty());
+    }
+
+    TEST_F(TargetMemoryCacheTest, ZeroLengthRangesAreNeverContained) {
+        this->insert(MEMORY_START_ADDRESS, MEMORY_SIZE);
+        EXPECT_FALSE(this->cache.contains(MEMORY_START_ADDRESS, 0));
+    }
+
+    TEST_F(TargetMemoryCacheTest, SingleInsertion) {
+        this->insert(0x150, 16);
+
+        EXPECT_TRUE(this->cache.contains(0x150, 16));
+        EXPECT_TRUE(this->cache.contains(0x155, 4));
+        EXPECT_FALSE(this->cache.contains(0x14F, 2));
+        EXPECT_FALSE(this->cache.contains(0x15F, 2));
+
+        this->expectFetch(0x150, 16);
+
+        const auto ranges = this->cache.populatedRanges();
+        ASSERT_EQ(ranges.size(), 1);
+        EXPECT_EQ(ranges[0], TargetMemoryAddressRange(0x150, 0x15F));
+    }
+
+    TEST_F(TargetMemoryCacheTest, BitmapWordBoundaries) {
+        // Indices 63 and 64 straddle the first two bitmap words
+        const auto boundaryAddress = static_cast<TargetMemoryAddress>(MEMORY_START_ADDRESS + 63);
+
+        this->insert(boundaryAddress, 2);
+
+        EXPECT_TRUE(this->cache.contains(boundaryAddress, 1));
+        EXPECT_TRUE(this->cache.contains(boundaryAddress + 1, 1));
+        EXPECT_TRUE(this->cache.contains(boundaryAddress, 2));
+        EXPECT_FALSE(this->cache.contains(boundaryAddress - 1, 2));
+        EXPECT_FALSE(this->cache.contains(boundaryAddress + 1, 2));
+
+        // A whole bitmap word (all 64 bits set)
+        const auto wordAddress = static_cast<TargetMemoryAddress>(MEMORY_START_ADDRESS + 128);
+        this->insert(wordAddress, 64);
+
+        EXPECT_TRUE(this->cache.contains(wordAddress, 64));
+        EXPECT_FALSE(this->cache.contains(wordAddress - 1, 65));
+        EXPECT_FALSE(this->cache.contains(wordAddress, 65));
+
+        const auto ranges = this->cache.populatedRanges();
+        ASSERT_EQ(ranges.size(), 2);
+        EXPECT_EQ(ranges[0], TargetMemoryAddressRange(boundaryAddress, boundaryAddress + 1));
+        EXPECT_EQ(ranges[1], TargetMemoryAddressRange(wordAddress, wordAddress + 63));
+    }
+
+    TEST_F(TargetMemoryCacheTest, FirstAndLastBytes) {
+        const auto lastAddress = static_cast<TargetMemoryAddress>(MEMORY_START_ADDRESS + MEMORY_SIZE - 1);
+
+        this->insert(MEMORY_START_ADDRESS, 1);
+        this->insert(lastAddress, 1);
+
+        EXPECT_TRUE(this->cache.contains(MEMORY_START_ADDRESS, 1));
+        EXPECT_TRUE(this->cache.contains(lastAddress, 1));
+        EXPECT_FALSE(this->cache.contains(lastAddress - 1, 2));
+
+        this->expectFetch(MEMORY_START_ADDRESS, 1);
+        this->expectFetch(lastAddress, 1);
+
+        const auto ranges = this->cache.populatedRanges();
+        ASSERT_EQ(ranges.size(), 2);
+        EXPECT_EQ(ranges[0], TargetMemoryAddressRange(MEMORY_START_ADDRESS, MEMORY_START_ADDRESS));
+        EXPECT_EQ(ranges[1], TargetMemoryAddressRange(lastAddress, lastAddress));
+    }
+
+    TEST_F(TargetMemoryCacheTest, FragmentedInsertions) {
+        // Every other byte, across several bitmap words
+        for (auto address = MEMORY_START_ADDRESS; address < MEMORY_START_ADDRESS + 300; address += 2) {
+            this->insert(address, 1);
+        }
+
+        EXPECT_FALSE(this->cache.contains(MEMORY_START_ADDRESS, 2));
+        EXPECT_EQ(this->cache.populatedRanges().size(), 150);
+
+        // Filling the gaps should merge everything into a single range
+        for (auto address = MEMORY_START_ADDRESS + 1; address < MEMORY_START_ADDRESS + 300; address += 2) {
+            this->insert(address, 1);
+        }
+
+        EXPECT_TRUE(this->cache.contains(MEMORY_START_ADDRESS, 300));
+        EXPECT_FALSE(this->cache.contains(MEMORY_START_ADDRESS, 301));
+        this->expectFetch(MEMORY_START_ADDRESS, 300);
+
+        const auto ranges = this->cache.populatedRanges();
+        ASSERT_EQ(ranges.size(), 1);
+        EXPECT_EQ(ranges[0], TargetMemoryAddressRange(MEMORY_START_ADDRESS, MEMORY_START_ADDRESS + 299));
+    }
+
+    TEST_F(TargetMemoryCacheTest, OverlappingInsertionsOverwriteData) {
+        this->cache.insert(0x200, TargetMemoryBuffer(32, 0xAA));
+        this->insert(0x210, 32);
+
+        const auto data = this->cache.fetch(0x200, 48);
+        EXPECT_EQ(TargetMemoryBuffer(data.begin(), data.begin() + 16), TargetMemoryBuffer(16, 0xAA));
+        this->expectFetch(0x210, 32);
+
+        const auto ranges = this->cache.populatedRanges();
+        ASSERT_EQ(ranges.size(), 1);
+        EXPECT_EQ(ranges[0], TargetMemoryAddressRange(0x200, 0x22F));
+    }
+
+    TEST_F(TargetMemoryCacheTest, FullRangeFill) {
+        this->insert(MEMORY_START_ADDRESS, MEMORY_SIZE);
+
+        EXPECT_TRUE(this->cache.contains(MEMORY_START_ADDRESS, MEMORY_SIZE));
+        this->expectFetch(MEMORY_START_ADDRESS, MEMORY_SIZE);
+
+        const auto ranges = this->cache.populatedRanges();
+        ASSERT_EQ(ranges.size(), 1);
+        EXPECT_EQ(ranges[0], this->memoryDescriptor.addressRange);
+    }
+
+    TEST_F(TargetMemoryCacheTest, InvalidateAndClear) {
+        this->insert(MEMORY_START_ADDRESS, MEMORY_SIZE);
+        this->cache.invalidate(0x140, 100);
+
+        EXPECT_TRUE(this->cache.contains(MEMORY_START_ADDRESS, 0x40));
+        EXPECT_FALSE(this->cache.contains(0x13F, 2));
+        EXPECT_FALSE(this->cache.contains(0x1A3, 1));
+        EXPECT_TRUE(this->cache.contains(0x1A4, 1));
+
+        const auto ranges = this->cache.populatedRanges();
+        ASSERT_EQ(ranges.size(), 2);
+        EXPECT_EQ(ranges[0], TargetMemoryAddressRange(MEMORY_START_ADDRESS, 0x13F));
+        EXPECT_EQ(ranges[1], TargetMemoryAddressRange(0x1A4, this->memoryDescriptor.addressRange.endAddress));
+
+        this->cache.clear();
+
+        EXPECT_FALSE(this->cache.contains(MEMORY_START_ADDRESS, 1));
+        EXPECT_TRUE(this->cache.populatedRanges().empty());
+    }
+
+    TEST_F(TargetMemoryCacheTest, OutOfBoundsAccess) {
+        EXPECT_FALSE(this->cache.contains(MEMORY_START_ADDRESS - 1, 1));
+        EXPECT_FALSE(this->cache.contains(MEMORY_START_ADDRESS, MEMORY_SIZE + 1));
+
+        EXPECT_THROW(
+            this->cache.insert(MEMORY_START_ADDRESS - 1, TargetMemoryBuffer(1, 0x00)),
+            Exceptions::Exception
+        );
+        EXPECT_THROW(
+            this->cache.insert(MEMORY_START_ADDRESS + MEMORY_SIZE - 1, TargetMemoryBuffer(2, 0x00)),
+            Exceptions::Exception
+        );
+        EXPECT_THROW(this->cache.fetch(MEMORY_START_ADDRESS, MEMORY_SIZE + 1), Exceptions::Exception);
+    }
+}